@@ -0,0 +1,122 @@
+#include "Environment.h"
+#include "Environment_Derived.h"
+
+// Benchmark Loop Count
+#define BENCHMARK_COUNT 200
+
+// Prevent Compiler From Removing Benchmark Loops
+volatile float Sink;
+
+void setup() {
+  
+  // Serial Communication Start
+  Serial.begin(115200);
+  
+  // Header
+  Serial.println("  Derived Metrics (LUT vs libm) ");
+  Serial.println("--------------------------------");
+
+  // Declare Variables
+  unsigned long Time;
+  float Error, Max_Error;
+
+  // ************************************************************
+  // Dew Point
+  // ************************************************************
+
+  // LUT Timing
+  Time = micros();
+  for (int i = 0; i < BENCHMARK_COUNT; i++) Sink = Environment_Derived::Dew_Point(i * 0.25, 20 + i * 0.4);
+  Serial.print("Dew Point LUT  : "); Serial.print((float)(micros() - Time) / BENCHMARK_COUNT); Serial.println(" uS");
+
+  // libm Timing and Error
+  Max_Error = 0;
+  Time = micros();
+  for (int i = 0; i < BENCHMARK_COUNT; i++) {
+    float T = i * 0.25, RH = 20 + i * 0.4;
+    float G = log(RH / 100) + 17.62 * T / (243.12 + T);
+    Sink = 243.12 * G / (17.62 - G);
+  }
+  Serial.print("Dew Point libm : "); Serial.print((float)(micros() - Time) / BENCHMARK_COUNT); Serial.println(" uS");
+  for (int i = 0; i < BENCHMARK_COUNT; i++) {
+    float T = i * 0.25, RH = 20 + i * 0.4;
+    float G = log(RH / 100) + 17.62 * T / (243.12 + T);
+    Error = fabs(Environment_Derived::Dew_Point(T, RH) - 243.12 * G / (17.62 - G));
+    if (Error > Max_Error) Max_Error = Error;
+  }
+  Serial.print("Dew Point Error: "); Serial.print(Max_Error, 5); Serial.println(" C");
+  Serial.println("--------------------------------");
+
+  // ************************************************************
+  // Absolute Humidity
+  // ************************************************************
+
+  // LUT Timing
+  Time = micros();
+  for (int i = 0; i < BENCHMARK_COUNT; i++) Sink = Environment_Derived::Absolute_Humidity(i * 0.25, 20 + i * 0.4);
+  Serial.print("Abs Hum LUT    : "); Serial.print((float)(micros() - Time) / BENCHMARK_COUNT); Serial.println(" uS");
+
+  // libm Timing and Error
+  Max_Error = 0;
+  Time = micros();
+  for (int i = 0; i < BENCHMARK_COUNT; i++) {
+    float T = i * 0.25, RH = 20 + i * 0.4;
+    Sink = 216.68 * (RH / 100) * 6.112 * exp(17.62 * T / (243.12 + T)) / (T + 273.15);
+  }
+  Serial.print("Abs Hum libm   : "); Serial.print((float)(micros() - Time) / BENCHMARK_COUNT); Serial.println(" uS");
+  for (int i = 0; i < BENCHMARK_COUNT; i++) {
+    float T = i * 0.25, RH = 20 + i * 0.4;
+    Error = fabs(Environment_Derived::Absolute_Humidity(T, RH) - 216.68 * (RH / 100) * 6.112 * exp(17.62 * T / (243.12 + T)) / (T + 273.15));
+    if (Error > Max_Error) Max_Error = Error;
+  }
+  Serial.print("Abs Hum Error  : "); Serial.print(Max_Error, 5); Serial.println(" g/m3");
+  Serial.println("--------------------------------");
+
+  // ************************************************************
+  // Altitude
+  // ************************************************************
+
+  // LUT Timing
+  Time = micros();
+  for (int i = 0; i < BENCHMARK_COUNT; i++) Sink = Environment_Derived::Altitude(600 + i * 2.0);
+  Serial.print("Altitude LUT   : "); Serial.print((float)(micros() - Time) / BENCHMARK_COUNT); Serial.println(" uS");
+
+  // libm Timing and Error
+  Max_Error = 0;
+  Time = micros();
+  for (int i = 0; i < BENCHMARK_COUNT; i++) Sink = 44330.77 * (1 - pow((600 + i * 2.0) / 1013.25, 0.190263));
+  Serial.print("Altitude libm  : "); Serial.print((float)(micros() - Time) / BENCHMARK_COUNT); Serial.println(" uS");
+  for (int i = 0; i < BENCHMARK_COUNT; i++) {
+    Error = fabs(Environment_Derived::Altitude(600 + i * 2.0) - 44330.77 * (1 - pow((600 + i * 2.0) / 1013.25, 0.190263)));
+    if (Error > Max_Error) Max_Error = Error;
+  }
+  Serial.print("Altitude Error : "); Serial.print(Max_Error, 3); Serial.println(" m");
+  Serial.println("--------------------------------");
+
+}
+
+void loop() {
+
+  // Set Start Time
+  unsigned long Time = millis();
+
+  // Measure
+  float _Temperature = Sensor.SHT21_Temperature(10,1);
+  float _Humidity = Sensor.SHT21_Humidity(10,1);
+  float _Pressure = Sensor.MPL3115A2_Pressure();
+
+  // Calculate Delta Time
+  long DT = millis() - Time;
+
+  // Serial Print Data
+  Serial.print("Dew Point     : "); Serial.print(Environment_Derived::Dew_Point(_Temperature, _Humidity), 3); Serial.println(" C");
+  Serial.print("Abs Humidity  : "); Serial.print(Environment_Derived::Absolute_Humidity(_Temperature, _Humidity), 3); Serial.println(" g/m3");
+  Serial.print("Heat Index    : "); Serial.print(Environment_Derived::Heat_Index(_Temperature, _Humidity), 3); Serial.println(" C");
+  Serial.print("Altitude      : "); Serial.print(Environment_Derived::Altitude(_Pressure), 3); Serial.println(" m");
+  Serial.print("Function Time : "); Serial.print(DT); Serial.println(" mS");
+  Serial.println("--------------------------------");
+
+  // Loop Delay
+  delay(1000);
+
+}
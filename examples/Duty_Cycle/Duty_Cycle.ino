@@ -0,0 +1,53 @@
+#include "Environment.h"
+#include "Environment_Scheduler.h"
+
+// Define Scheduler
+Environment_Scheduler Scheduler;
+
+void setup() {
+  
+  // Serial Communication Start
+  Serial.begin(115200);
+  
+  // Start I2C
+  Wire.begin();
+
+  // Start Sensors (configured sensors skip reset after a reboot)
+  Sensor.Begin();
+
+  // Sensor Supply (V)
+  Scheduler.Set_Supply_Voltage(3.3);
+
+  // Schedule Channels (period in mS, sample count)
+  Scheduler.Add(ENV_SHT21_TEMPERATURE, 60000, 3);
+  Scheduler.Add(ENV_SHT21_HUMIDITY, 60000, 3);
+  Scheduler.Add(ENV_MPL3115A2_PRESSURE, 300000);
+  Scheduler.Add(ENV_TSL2561_LIGHT, 10000);
+
+  // Header
+  Serial.println("     Duty Cycle Read      ");
+  Serial.println("--------------------------");
+
+}
+
+void loop() {
+  
+  // Read Due Channels and Power Down Sensors
+  if (Scheduler.Run() > 0) {
+
+    // Serial Print Data
+    Serial.print("Temperature   : "); Serial.print(Sensor.Reading(ENV_SHT21_TEMPERATURE).Value, 3); Serial.println(" C");
+    Serial.print("Humidity      : "); Serial.print(Sensor.Reading(ENV_SHT21_HUMIDITY).Value, 3); Serial.println(" %");
+    Serial.print("Pressure      : "); Serial.print(Sensor.Reading(ENV_MPL3115A2_PRESSURE).Value, 3); Serial.println(" mBar");
+    Serial.print("Light         : "); Serial.print(Sensor.Reading(ENV_TSL2561_LIGHT).Value, 3); Serial.println(" Lux");
+    Serial.print("Light Energy  : "); Serial.print(Scheduler.Energy_Per_Reading(ENV_TSL2561_LIGHT), 2); Serial.println(" uJ");
+    Serial.print("Energy / Hour : "); Serial.print(Scheduler.Energy_Per_Hour(), 2); Serial.println(" mJ");
+    Serial.print("Avg. Current  : "); Serial.print(Scheduler.Average_Current(), 2); Serial.println(" uA");
+    Serial.println("--------------------------");
+
+  }
+  
+  // Wait Until Next Reading (replace with MCU sleep on battery nodes)
+  delay(Scheduler.Next_Due());
+
+}
@@ -0,0 +1,81 @@
+#include "Environment.h"
+#include "Environment_Sampler.h"
+
+// Define Sampler (5 Hz light, 16 record ring)
+Environment_Sample Samples[16];
+Environment_Sampler Sampler(Samples, 16);
+
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__)
+
+// Timer 1 Compare Interrupt (sample slot)
+ISR(TIMER1_COMPA_vect) {
+
+  // Count Slot
+  Sampler.Tick();
+
+}
+
+#endif
+
+void setup() {
+  
+  // Serial Communication Start
+  Serial.begin(115200);
+  
+  // Start I2C
+  Wire.begin();
+
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega2560__)
+
+  // Timer 1 CTC, 16 MHz / 256 / 12500 = 5 Hz
+  noInterrupts();
+  TCCR1A = 0;
+  TCCR1B = (1 << WGM12) | (1 << CS12);
+  OCR1A = 12499;
+  TIMSK1 = (1 << OCIE1A);
+  interrupts();
+
+  // Start Sampler on Timer
+  Sampler.Begin(ENV_TSL2561_LIGHT, 200000, true);
+
+#else
+
+  // Start Sampler on Own Grid
+  Sampler.Begin(ENV_TSL2561_LIGHT, 200000);
+
+#endif
+
+  // Header
+  Serial.println("    Fixed Rate Sampler    ");
+  Serial.println("--------------------------");
+
+}
+
+void loop() {
+  
+  // Run Sampler
+  Sampler.Poll();
+
+  // Drain Samples Once a Second
+  static uint32_t Last_Print = 0;
+  if (millis() - Last_Print < 1000) return;
+  Last_Print = millis();
+
+  // Serial Print Samples
+  Environment_Sample Sample;
+  while (Sampler.Read(Sample)) {
+
+    // Serial Print Data
+    Serial.print(Sample.Time); Serial.print(" uS : "); Serial.println(Sample.Value, 2);
+
+  }
+
+  // Serial Print Statistics
+  Serial.print("Period        : "); Serial.print(Sampler.Period()); Serial.println(" uS");
+  Serial.print("Jitter        : "); Serial.print(Sampler.Jitter(), 1); Serial.println(" uS");
+  Serial.print("Max Jitter    : "); Serial.print(Sampler.Max_Jitter()); Serial.println(" uS");
+  Serial.print("Overrun       : "); Serial.println(Sampler.Overrun_Count());
+  Serial.print("Dropped       : "); Serial.println(Sampler.Dropped_Count());
+  Serial.println("--------------------------");
+
+}
@@ -0,0 +1,66 @@
+#include "Environment.h"
+#include "Environment_Serializer.h"
+
+// Define Serializers
+Environment_Serializer JSON(ENV_FORMAT_JSON);
+Environment_Serializer CBOR(ENV_FORMAT_CBOR);
+
+// Document Buffer
+uint8_t Document[256];
+
+// Stream Output
+void Stream_Output(const uint8_t * Data_, const uint16_t Length_) {
+
+  // Send Chunk
+  Serial.write(Data_, Length_);
+
+}
+
+void setup() {
+  
+  // Serial Communication Start
+  Serial.begin(115200);
+  
+  // Start I2C
+  Wire.begin();
+  
+  // Header
+  Serial.println("       JSON Report        ");
+  Serial.println("--------------------------");
+
+}
+
+void loop() {
+  
+  // Measure
+  Sensor.SHT21_Temperature(10,1);
+  Sensor.SHT21_Humidity(10,1);
+  Sensor.MPL3115A2_Pressure();
+
+  // Set Start Time
+  unsigned long Time = micros();
+
+  // Write JSON Document to Buffer
+  uint16_t JSON_Length = JSON.Write(Sensor.Readings(), Document, sizeof(Document));
+
+  // Calculate Delta Time
+  long DT = micros() - Time;
+
+  // Get CBOR Length
+  uint16_t CBOR_Length = CBOR.Length(Sensor.Readings());
+
+  // Serial Print Data
+  Serial.println((const char *)Document);
+  Serial.print("JSON Length   : "); Serial.print(JSON_Length); Serial.println(" Byte");
+  Serial.print("CBOR Length   : "); Serial.print(CBOR_Length); Serial.println(" Byte");
+  Serial.print("Function Time : "); Serial.print(DT); Serial.println(" uS");
+
+  // Stream Temperature Only (no document buffer)
+  JSON.Write(Sensor.Readings(), Stream_Output, (1 << ENV_SHT21_TEMPERATURE));
+  Serial.println();
+  Serial.println("--------------------------");
+  
+  // Loop Delay
+  delay(1000);
+
+}
@@ -0,0 +1,58 @@
+#include "Environment.h"
+
+// Define Sensor Racks (one Environment object per sensor set)
+Environment Rack_A;
+Environment Rack_B;
+
+void setup() {
+  
+  // Serial Communication Start
+  Serial.begin(115200);
+  
+  // Start I2C
+  Wire.begin();
+
+  // Run Sensor Transactions at 400 kHz, Restore 100 kHz Afterwards
+  Environment_I2C.Set_Clock_Policy(ENV_CLOCK_FAST, 100000);
+
+  // Rack A - SHT21 on TCA9548A channel 0, HDC2010 (ADDR high) on channel 1
+  Rack_A.Set_Mux(ENV_SHT21, ENV_MUX_TCA9548A, 0);
+  Rack_A.Set_Mux(ENV_HDC2010, ENV_MUX_TCA9548A, 1);
+  Rack_A.Set_Address(ENV_HDC2010, ENV_HDC2010_ADDRESS_ALT);
+
+  // Rack B - SHT21 on TCA9548A channel 2, HDC2010 on channel 3
+  Rack_B.Set_Mux(ENV_SHT21, ENV_MUX_TCA9548A, 2);
+  Rack_B.Set_Mux(ENV_HDC2010, ENV_MUX_TCA9548A, 3);
+  
+  // Header
+  Serial.println("    Multiplexer Array     ");
+  Serial.println("--------------------------");
+
+}
+
+void loop() {
+  
+  // Set Start Time
+  unsigned long Time = millis();
+
+  // Measure
+  float _Rack_A_SHT21 = Rack_A.SHT21_Temperature(10,1);
+  float _Rack_A_HDC2010 = Rack_A.HDC2010_Temperature(10,1);
+  float _Rack_B_SHT21 = Rack_B.SHT21_Temperature(10,1);
+  float _Rack_B_HDC2010 = Rack_B.HDC2010_Temperature(10,1);
+
+  // Calculate Delta Time
+  long DT = millis() - Time;
+    
+  // Serial Print Data
+  Serial.print("Rack A SHT21  : "); Serial.print(_Rack_A_SHT21, 3); Serial.println(" C");
+  Serial.print("Rack A HDC2010: "); Serial.print(_Rack_A_HDC2010, 3); Serial.println(" C");
+  Serial.print("Rack B SHT21  : "); Serial.print(_Rack_B_SHT21, 3); Serial.println(" C");
+  Serial.print("Rack B HDC2010: "); Serial.print(_Rack_B_HDC2010, 3); Serial.println(" C");
+  Serial.print("Function Time : "); Serial.print(DT); Serial.println(" mS");
+  Serial.println("--------------------------");
+  
+  // Loop Delay
+  delay(1000);
+
+}
@@ -0,0 +1,68 @@
+#include "Environment.h"
+#include "Environment_Log.h"
+#include "Environment_EEPROM.h"
+
+// Define Reading Log (whole EEPROM, 64 byte pages)
+Environment_EEPROM Storage;
+Environment_Log Log(Storage);
+
+// Radio State (replace with modem status)
+bool Radio_Online(void) {
+
+  // Upload Every Tenth Loop
+  return(millis() / 1000 % 10 == 0);
+
+}
+
+void setup() {
+  
+  // Serial Communication Start
+  Serial.begin(115200);
+  
+  // Start I2C
+  Wire.begin();
+  
+  // Find Newest Log Page
+  Log.Begin();
+
+  // Header
+  Serial.println("        Outage Log        ");
+  Serial.println("--------------------------");
+  Serial.print("Buffered      : "); Serial.print(Log.Count()); Serial.println(" Record");
+  Serial.print("Capacity      : "); Serial.print(Log.Capacity()); Serial.println(" Record");
+  Serial.println("--------------------------");
+
+}
+
+void loop() {
+  
+  // Measure
+  Sensor.SHT21_Temperature(10,1);
+  Sensor.MPL3115A2_Pressure();
+
+  // Buffer Readings
+  Log.Append(ENV_SHT21_TEMPERATURE, Sensor.Reading(ENV_SHT21_TEMPERATURE));
+  Log.Append(ENV_MPL3115A2_PRESSURE, Sensor.Reading(ENV_MPL3115A2_PRESSURE));
+
+  // Upload Buffered Readings
+  if (Radio_Online()) {
+
+    // Send Records
+    Environment_Record Record;
+    while (Log.Read(Record)) {
+
+      // Serial Print Data
+      Serial.print(Record.Time); Serial.print(" mS, Channel "); Serial.print(Record.Channel); Serial.print(" : "); Serial.println(Record.Value, 3);
+
+    }
+
+    // Drop Sent Records
+    Log.Truncate();
+    Serial.println("--------------------------");
+
+  }
+  
+  // Loop Delay
+  delay(1000);
+
+}
@@ -0,0 +1,46 @@
+#include "Environment_TSL2561.h"
+
+// Define Bus (sketch owned, no library objects are linked)
+Environment_Wire Light_Port(Wire);
+Environment_Bus Light_Bus(Light_Port);
+
+// Define Light Sensor (only TSL2561 driver code is linked)
+Environment_TSL2561 Light_Sensor(Light_Bus);
+
+void setup() {
+  
+  // Serial Communication Start
+  Serial.begin(115200);
+  
+  // Start I2C
+  Wire.begin();
+  
+  // Header
+  Serial.println("      TSL2561 Driver      ");
+  Serial.println("--------------------------");
+
+}
+
+void loop() {
+  
+  // Set Start Time
+  unsigned long Time = millis();
+
+  // Measure
+  float _Measurement = Light_Sensor.Light();
+
+  // Power Off Between Readings
+  Light_Sensor.Power_Down();
+
+  // Calculate Delta Time
+  long DT = millis() - Time;
+    
+  // Serial Print Data
+  Serial.print("Value         : "); Serial.print(_Measurement, 3); Serial.println(" Lux");
+  Serial.print("Function Time : "); Serial.print(DT); Serial.println(" mS");
+  Serial.println("--------------------------");
+  
+  // Loop Delay
+  delay(1000);
+
+}
@@ -0,0 +1,49 @@
+#include "Environment.h"
+#include "Environment_Trace.h"
+
+// Define Trace Output (hex dump, one line per buffer)
+void Trace_Output(const uint8_t * Data_, const uint16_t Length_) {
+
+  // Print Bytes
+  for (uint16_t i = 0; i < Length_; i++) {
+    if (Data_[i] < 0x10) Serial.print("0");
+    Serial.print(Data_[i], HEX);
+  }
+  Serial.println();
+
+}
+
+// Define Recording Bus (Wire transport wrapped by recorder)
+uint8_t Trace_Buffer[64];
+Environment_Recorder Recorder(Environment_Wire_Port, Trace_Buffer, sizeof(Trace_Buffer), Trace_Output);
+Environment_Bus Recorded_Bus(Recorder);
+Environment_Async Recorded_Queue(Recorded_Bus);
+Environment Recorded_Sensor(Recorded_Bus, Recorded_Queue);
+
+void setup() {
+  
+  // Serial Communication Start
+  Serial.begin(115200);
+  
+  // Start I2C
+  Wire.begin();
+
+  // Header
+  Serial.println("       Trace Record       ");
+  Serial.println("--------------------------");
+
+  // Record One Reading of Every Channel
+  Recorder.Start();
+  for (uint8_t Channel = 0; Channel < ENV_CHANNEL_COUNT; Channel++) Recorded_Sensor.Read(Channel, 10, 1);
+  Recorder.Stop();
+
+  // Serial Print Summary
+  Serial.println("--------------------------");
+  Serial.print("Records       : "); Serial.println(Recorder.Record_Count());
+  Serial.print("Trace Size    : "); Serial.print(Recorder.Trace_Size()); Serial.println(" Byte");
+
+}
+
+void loop() {
+
+}
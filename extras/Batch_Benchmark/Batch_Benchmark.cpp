@@ -0,0 +1,189 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Batch Conversion Host Benchmark.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *	Build on a Linux host:
+ *
+ *	g++ -O2 -I../../src Batch_Benchmark.cpp ../../src/Environment*.cpp -o Batch_Benchmark
+ *
+ *********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Environment.h"
+#include "Environment_Batch.h"
+
+// Benchmark Settings
+#define BENCH_COUNT				(1UL << 20)	// Codes per call
+#define BENCH_ROUNDS			50			// Calls per kernel and channel
+#define BENCH_LIGHT_CHECKS		4000000		// Random TSL2561 count pairs compared with the driver
+
+// Kernel Names
+const char * Bench_Kernel[] = {"Scalar", "SSE4.1", "AVX2"};
+
+// Compare Float Bits
+bool Bench_Same(const float A_, const float B_) {
+
+	// End Function
+	return(memcmp(&A_, &B_, sizeof(float)) == 0);
+
+}
+
+int main(void) {
+
+	// Declare Buffers
+	uint16_t * Raw_ = (uint16_t *)malloc(BENCH_COUNT * sizeof(uint16_t));
+	uint16_t * Raw_1_ = (uint16_t *)malloc(BENCH_COUNT * sizeof(uint16_t));
+	uint32_t * Pressure_Raw_ = (uint32_t *)malloc(BENCH_COUNT * sizeof(uint32_t));
+	float * Value_ = (float *)malloc(BENCH_COUNT * sizeof(float));
+	float * Reference_ = (float *)malloc(BENCH_COUNT * sizeof(float));
+
+	// Channel Descriptors
+	const Environment_Descriptor * Descriptor_[] = {&ENV_SHT21_T_DESCRIPTOR, &ENV_SHT21_H_DESCRIPTOR, &ENV_HDC2010_T_DESCRIPTOR, &ENV_HDC2010_H_DESCRIPTOR};
+	const char * Descriptor_Name_[] = {"SHT21 T", "SHT21 RH", "HDC2010 T", "HDC2010 RH"};
+
+	// Best Kernel of CPU
+	uint8_t Best_ = Environment_Batch::Set_Kernel(ENV_BATCH_AVX2);
+	printf("CPU kernel       : %s\n", Bench_Kernel[Best_]);
+
+	// ************************************************************
+	// Bit Compatibility (every kernel against the device read path)
+	// ************************************************************
+
+	// Declare Mismatch Counter
+	uint32_t Mismatch_ = 0;
+
+	// Every Code of Descriptor Channels
+	for (uint32_t i = 0; i < 65536; i++) Raw_[i] = (uint16_t)i;
+	for (uint8_t d = 0; d < 4; d++) {
+
+		// Device Conversion of Single Reads (result bytes in sensor order)
+		for (uint32_t i = 0; i < 65536; i++) {
+
+			// Set Result Bytes
+			uint8_t Data_[2];
+			bool MSB_First_ = (d < 2);
+			Data_[0] = MSB_First_ ? (uint8_t)(i >> 8) : (uint8_t)i;
+			Data_[1] = MSB_First_ ? (uint8_t)i : (uint8_t)(i >> 8);
+
+			// Convert Code
+			Reference_[i] = Environment_Acquisition::Value(Descriptor_[d], Data_);
+
+		}
+
+		// Run Kernels
+		for (uint8_t k = 0; k <= Best_; k++) {
+
+			// Convert Codes
+			Environment_Batch::Set_Kernel(k);
+			Environment_Batch::Convert(Descriptor_[d], Raw_, Value_, 65536);
+
+			// Compare Values
+			for (uint32_t i = 0; i < 65536; i++) if (!Bench_Same(Value_[i], Reference_[i])) Mismatch_++;
+
+		}
+
+	}
+
+	// Every 20 Bit Pressure Code (scalar kernel is the device formula in single precision)
+	for (uint32_t i = 0; i < BENCH_COUNT; i++) Pressure_Raw_[i] = i;
+	Environment_Batch::Set_Kernel(ENV_BATCH_SCALAR);
+	Environment_Batch::Pressure(Pressure_Raw_, Reference_, BENCH_COUNT);
+	for (uint8_t k = 1; k <= Best_; k++) {
+
+		// Convert Codes
+		Environment_Batch::Set_Kernel(k);
+		Environment_Batch::Pressure(Pressure_Raw_, Value_, BENCH_COUNT);
+
+		// Compare Values
+		for (uint32_t i = 0; i < BENCH_COUNT; i++) if (!Bench_Same(Value_[i], Reference_[i])) Mismatch_++;
+
+	}
+
+	// Random Light Counts Against Driver Lux (every integration time and gain)
+	srand(1);
+	for (uint32_t i = 0; i < BENCH_COUNT; i++) {
+
+		// Set Counts (full range and dark sky)
+		Raw_[i] = (i & 1) ? (uint16_t)rand() : (uint16_t)(rand() % 64);
+		Raw_1_[i] = (i & 2) ? (uint16_t)rand() : (uint16_t)(rand() % 64);
+
+	}
+	for (uint8_t t = 1; t <= 3; t++) for (uint8_t g = 1; g <= 2; g++) {
+
+		// Driver Lux
+		for (uint32_t i = 0; i < BENCH_LIGHT_CHECKS / 6 and i < BENCH_COUNT; i++) Reference_[i] = Environment_TSL2561::Lux(Raw_[i], Raw_1_[i], t, g);
+
+		// Run Kernels
+		for (uint8_t k = 0; k <= Best_; k++) {
+
+			// Convert Counts
+			Environment_Batch::Set_Kernel(k);
+			Environment_Batch::Light(Raw_, Raw_1_, Value_, BENCH_COUNT, t, g);
+
+			// Compare Values
+			for (uint32_t i = 0; i < BENCH_LIGHT_CHECKS / 6 and i < BENCH_COUNT; i++) if (!Bench_Same(Value_[i], Reference_[i])) Mismatch_++;
+
+		}
+
+	}
+
+	// Print Result
+	printf("Mismatches       : %u\n", Mismatch_);
+	printf("--------------------------------------------------\n");
+
+	// ************************************************************
+	// Throughput (one thread, samples per second per core)
+	// ************************************************************
+
+	// Header
+	printf("%-12s %-8s %16s\n", "Channel", "Kernel", "M samples / s");
+
+	// Random Codes
+	for (uint32_t i = 0; i < BENCH_COUNT; i++) Raw_[i] = (uint16_t)rand();
+
+	// Run Channels
+	for (uint8_t c = 0; c < 6; c++) {
+
+		// Run Kernels
+		for (uint8_t k = 0; k <= Best_; k++) {
+
+			// Set Kernel
+			Environment_Batch::Set_Kernel(k);
+
+			// Time Conversions
+			uint32_t Start_ = micros();
+			for (uint16_t r = 0; r < BENCH_ROUNDS; r++) {
+
+				// Convert Channel
+				if (c < 4) Environment_Batch::Convert(Descriptor_[c], Raw_, Value_, BENCH_COUNT);
+				if (c == 4) Environment_Batch::Pressure(Pressure_Raw_, Value_, BENCH_COUNT);
+				if (c == 5) Environment_Batch::Light(Raw_, Raw_1_, Value_, BENCH_COUNT);
+
+			}
+			uint32_t Time_ = micros() - Start_;
+
+			// Print Result
+			printf("%-12s %-8s %16.1f\n", (c < 4) ? Descriptor_Name_[c] : ((c == 4) ? "MPL3115A2 P" : "TSL2561 L"), Bench_Kernel[k], (double)BENCH_COUNT * BENCH_ROUNDS / Time_);
+
+		}
+
+	}
+
+	// Free Buffers
+	free(Raw_);
+	free(Raw_1_);
+	free(Pressure_Raw_);
+	free(Value_);
+	free(Reference_);
+
+	// End Function
+	return(Mismatch_ == 0 ? 0 : 1);
+
+}
@@ -0,0 +1,129 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Reading Log Host Benchmark.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *	Build on a Linux host:
+ *
+ *	g++ -O2 -I../../src Log_Benchmark.cpp ../../src/Environment_Log.cpp \
+ *		../../src/Environment_Mapped.cpp ../../src/Environment_Platform.cpp -o Log_Benchmark
+ *
+ *********************************************************************************/
+
+#include <stdio.h>
+#include "Environment_Log.h"
+#include "Environment_Mapped.h"
+
+// Benchmark Settings
+#define BENCH_FILE				"Log_Benchmark.bin"
+#define BENCH_PAGES				16		// 1 KB region, like an ATmega328P EEPROM
+#define BENCH_PAGE_SIZE			64
+#define BENCH_OUTAGES			200		// Outage and upload cycles
+#define BENCH_OUTAGE_RECORDS	37		// Readings buffered per outage
+#define BENCH_FLUSH_EVERY		10		// Flush (sleep) interval in readings
+
+// Storage Counting Page Writes (wear per page)
+class Bench_Storage : public Environment_Storage
+{
+public:
+
+	Bench_Storage(Environment_Storage & Target_) : Target(Target_) { for (uint16_t i = 0; i < BENCH_PAGES; i++) Writes[i] = 0; }
+
+	uint16_t Page_Count(void) { return(Target.Page_Count()); }
+	uint16_t Page_Size(void) { return(Target.Page_Size()); }
+	bool Read(const uint16_t Page_, const uint16_t Offset_, uint8_t * Data_, const uint16_t Length_) { return(Target.Read(Page_, Offset_, Data_, Length_)); }
+	bool Write(const uint16_t Page_, const uint8_t * Data_) { Writes[Page_]++; return(Target.Write(Page_, Data_)); }
+
+	uint32_t Writes[BENCH_PAGES];
+
+private:
+
+	Environment_Storage & Target;
+
+};
+
+int main(void) {
+
+	// Declare Storage
+	remove(BENCH_FILE);
+	Environment_Mapped_File File_(BENCH_FILE, BENCH_PAGES, BENCH_PAGE_SIZE);
+	Bench_Storage Storage_(File_);
+
+	// Declare Log
+	Environment_Log Log_(Storage_);
+	if (!Log_.Begin()) {
+
+		// Print Error
+		printf("Storage mount failed\n");
+
+		// End Function
+		return(1);
+
+	}
+
+	// Declare Counters
+	uint32_t Written_ = 0, Read_ = 0, Errors_ = 0;
+	uint32_t Append_Time_ = 0, Read_Time_ = 0;
+
+	// Run Outage Cycles
+	for (uint16_t c = 0; c < BENCH_OUTAGES; c++) {
+
+		// Buffer Readings
+		uint32_t Start_ = micros();
+		for (uint16_t i = 0; i < BENCH_OUTAGE_RECORDS; i++) {
+
+			// Append Reading
+			Log_.Append(Written_ % ENV_CHANNEL_COUNT, 20.0 + (Written_ % 100) * 0.01, Written_);
+			Written_++;
+
+			// Flush Before Sleep
+			if (Written_ % BENCH_FLUSH_EVERY == 0) Log_.Flush();
+
+		}
+		Append_Time_ += micros() - Start_;
+
+		// Upload and Truncate
+		Start_ = micros();
+		Environment_Record Record_;
+		while (Log_.Read(Record_)) {
+
+			// Control for Record Order
+			if (Record_.Time != Read_) Errors_++;
+			Read_++;
+
+		}
+		Log_.Truncate();
+		Read_Time_ += micros() - Start_;
+
+	}
+
+	// Print Result
+	printf("Records          : %u written, %u read, %u order errors\n", Written_, Read_, Errors_);
+	printf("Capacity         : %u records in %u pages of %u bytes\n", Log_.Capacity(), BENCH_PAGES, BENCH_PAGE_SIZE);
+	printf("Append           : %.1f ns / record (with flushes)\n", 1000.0 * Append_Time_ / Written_);
+	printf("Read + truncate  : %.1f ns / record\n", 1000.0 * Read_Time_ / Read_);
+	printf("Page writes      : %u (%.3f per record)\n", File_.Write_Count(), (double)File_.Write_Count() / Written_);
+
+	// Print Wear
+	uint32_t Min_ = 0xFFFFFFFF, Max_ = 0;
+	for (uint16_t i = 0; i < BENCH_PAGES; i++) {
+
+		// Set Limits
+		if (Storage_.Writes[i] < Min_) Min_ = Storage_.Writes[i];
+		if (Storage_.Writes[i] > Max_) Max_ = Storage_.Writes[i];
+
+	}
+	printf("Writes per page  : min %u, max %u\n", Min_, Max_);
+
+	// Remove File
+	remove(BENCH_FILE);
+
+	// End Function
+	return(0);
+
+}
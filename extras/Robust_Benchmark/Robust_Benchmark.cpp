@@ -0,0 +1,122 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Robust Average Host Benchmark.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *	Build on a Linux host (Statistical library on the include path):
+ *
+ *	g++ -O2 -I../../src -I<Statistical> Robust_Benchmark.cpp \
+ *		../../src/Environment_Robust.cpp ../../src/Environment_Platform.cpp -o Robust_Benchmark
+ *
+ *********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <Statistical.h>
+#include "Environment_Robust.h"
+
+// Benchmark Settings
+#define BENCH_TRUE_CODE			26000	// Noise free raw code (about 23 C on SHT21)
+#define BENCH_NOISE				8		// Noise amplitude (codes, uniform)
+#define BENCH_SPIKE_PERCENT		10		// Samples replaced by bus glitches (0xFFFC)
+#define BENCH_ROUNDS			20000	// Calls per estimator and count
+
+// Estimator Names (0 is the Statistical path used before)
+const char * Bench_Name[] = {"Statistical", "Mean", "Median", "Trimmed", "MAD"};
+const uint8_t Bench_Type[] = {1, ENV_AVERAGE_MEAN, ENV_AVERAGE_MEDIAN, ENV_AVERAGE_TRIMMED, ENV_AVERAGE_MAD};
+
+// Fill Sample Set
+void Bench_Fill(uint16_t * Data_, const uint8_t Count_) {
+
+	// Noisy Codes With Spikes
+	for (uint8_t i = 0; i < Count_; i++) {
+
+		// Set Sample
+		Data_[i] = BENCH_TRUE_CODE + (rand() % (2 * BENCH_NOISE + 1)) - BENCH_NOISE;
+
+		// Set Spike
+		if (rand() % 100 < BENCH_SPIKE_PERCENT) Data_[i] = 0xFFFC;
+
+	}
+
+}
+
+int main(void) {
+
+	// Sample Counts
+	const uint8_t Count_List_[] = {3, 5, 8, 10, 20, 50};
+
+	// Header
+	printf("%-6s %-12s %12s %14s\n", "Count", "Estimator", "ns / call", "Mean error");
+
+	// Run Sample Counts
+	for (uint8_t c = 0; c < sizeof(Count_List_); c++) {
+
+		// Get Count
+		uint8_t Count_ = Count_List_[c];
+
+		// Run Estimators
+		for (uint8_t e = 0; e < sizeof(Bench_Type); e++) {
+
+			// Declare Variables
+			uint16_t Source_[64], Work_[64];
+			float Float_[64];
+			double Error_ = 0;
+			uint32_t Time_ = 0;
+			Statistical DataSet_;
+
+			// Same Data for Every Estimator
+			srand(Count_);
+
+			// Run Rounds
+			for (uint16_t r = 0; r < BENCH_ROUNDS; r++) {
+
+				// Prepare Input (not timed)
+				Bench_Fill(Source_, Count_);
+				for (uint8_t i = 0; i < Count_; i++) Work_[i] = Source_[i];
+				for (uint8_t i = 0; i < Count_; i++) Float_[i] = Source_[i];
+
+				// Time Estimator
+				float Value_;
+				uint32_t Start_ = micros();
+				for (uint8_t k = 0; k < 10; k++) {
+
+					// Restore Input (estimators reorder data)
+					for (uint8_t i = 0; i < Count_; i++) Work_[i] = Source_[i];
+
+					// Calculate Estimate
+					if (e == 0) {
+
+						DataSet_.Array_Statistic(Float_, Count_, Bench_Type[e]);
+						Value_ = DataSet_.Array_Average;
+
+					} else {
+
+						Value_ = Environment_Robust::Estimate(Work_, Count_, Bench_Type[e]);
+
+					}
+
+				}
+				Time_ += micros() - Start_;
+
+				// Sum Absolute Error
+				Error_ += (Value_ > BENCH_TRUE_CODE) ? Value_ - BENCH_TRUE_CODE : BENCH_TRUE_CODE - Value_;
+
+			}
+
+			// Print Result
+			printf("%-6u %-12s %12.1f %14.2f\n", Count_, Bench_Name[e], 1000.0 * Time_ / BENCH_ROUNDS / 10, Error_ / BENCH_ROUNDS);
+
+		}
+
+	}
+
+	// End Function
+	return(0);
+
+}
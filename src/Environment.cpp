@@ -12,1570 +12,773 @@
 
 #include "Environment.h"
 
-// Define Objects
-Statistical DataSet_SHT21T;
-Statistical DataSet_SHT21H;
-Statistical DataSet_HDC2010T;
-Statistical DataSet_HDC2010H;
+// Asynchronous Read Step
+struct Environment_Step {
+
+	uint8_t		Channel;							// Channel of step
+	uint8_t		Command[ENV_ASYNC_COMMAND_SIZE];	// Command phase bytes
+	uint8_t		Command_Length;						// Command phase length
+	uint16_t	Wait;								// Conversion wait (ms)
+	uint8_t		Register;							// Read register
+	uint8_t		Offset;								// Job data offset
+	uint8_t		Length;								// Read length
+	uint8_t		Retry;								// Read retries on NACK
+
+};
+
+// Asynchronous Read Steps (steps of a channel are consecutive)
+const Environment_Step ENV_ASYNC_STEP[] PROGMEM = {
+	{ENV_SHT21_TEMPERATURE,		{0xF3, 0x00, 0x00}, 1, 85,	ENV_ASYNC_NO_REGISTER,	0, 3, 5},	// No hold master T, 14 bit max 85 ms
+	{ENV_SHT21_HUMIDITY,		{0xF5, 0x00, 0x00}, 1, 29,	ENV_ASYNC_NO_REGISTER,	0, 3, 5},	// No hold master RH, 12 bit max 29 ms
+	{ENV_HDC2010_TEMPERATURE,	{0x0E, 0x00, 0x03}, 3, 2,	0x00,					0, 2, 0},	// Manual mode, T only 14 bit, trigger
+	{ENV_HDC2010_HUMIDITY,		{0x0E, 0x00, 0x05}, 3, 2,	0x02,					0, 2, 0},	// Manual mode, RH only 14 bit, trigger
+	{ENV_MPL3115A2_PRESSURE,	{0x26, 0x3A, 0x00}, 2, 520,	0x00,					0, 4, 0},	// One shot OS 128 (returns to standby), status and P
+	{ENV_TSL2561_LIGHT,			{0x81, 0x10, 0x00}, 2, 0,	ENV_ASYNC_NO_REGISTER,	0, 0, 0},	// Timing 13.7 ms, high gain
+	{ENV_TSL2561_LIGHT,			{0x80, 0x03, 0x00}, 2, 14,	0xAC,					0, 2, 0},	// Power on, integrate, read CH0 word
+	{ENV_TSL2561_LIGHT,			{0x00, 0x00, 0x00}, 0, 0,	0xAE,					2, 2, 0},	// Read CH1 word
+	{ENV_TSL2561_LIGHT,			{0x80, 0x00, 0x00}, 2, 0,	ENV_ASYNC_NO_REGISTER,	0, 0, 0}	// Power off
+};
+#define ENV_ASYNC_STEP_COUNT		(sizeof(ENV_ASYNC_STEP) / sizeof(Environment_Step))
+
+Environment::Environment(Environment_Bus & Bus_, Environment_Async & Queue_) : SHT21(Bus_), HDC2010(Bus_), MPL3115A2(Bus_), TSL2561(Bus_) {
+
+	// No Rollup Attached
+	Rollup_Head = NULL;
+
+	// Set Asynchronous Queue
+	Queue = &Queue_;
+	Async_Pending = 0;
+	Async_Callback = NULL;
+
+	// Fixed Sample Count by Default
+	for (uint8_t i = 0; i < ENV_CHANNEL_COUNT; i++) Adaptive[i] = {0, 0, 0};
+
+	// Descriptor Resolution by Default
+	for (uint8_t i = 0; i < ENV_CHANNEL_COUNT; i++) Resolution[i] = ENV_RESOLUTION_DEFAULT;
+
+	// Set Asynchronous Jobs
+	for (uint8_t i = 0; i < ENV_DEVICE_COUNT; i++) {
+
+		// Bind Job to Device
+		Job[i].Device = Driver(i).Get_Device();
+		Job[i].Callback = Async_Complete;
+		Job[i].Context = this;
+		Job[i].Status = ENV_ASYNC_IDLE;
+		Job[i].Next = NULL;
 
-// Sensor Functions
-float Environment::SHT21_Temperature(const uint8_t Read_Count_, const uint8_t Average_Type_) {
-	
-	/******************************************************************************
-	 *	Project		: SHT21 Temperature Read Function
-	 *	Developer	: Mehmet Gunce Akkoyun (akkoyun@me.com)
-	 *	Revision	: 04.00.00
-	 *	Release		: 04.11.2020
-	 ******************************************************************************/
-	
-	// Set Sensor Definations
-	struct Sensor_Settings {
-		
-		uint8_t 	Resolution;
-		bool		EoB;
-		bool		OCH;
-		bool		OTP;
-		int			Range_Min;
-		int			Range_Max;
-		
-	};
-	Sensor_Settings SHT21[] {
-		
-		14,			// Measurement Resolution
-		false,		// Sensor End of Battery Setting
-		false,		// On Chip Heater Setting
-		true,		// OTP Read
-		-40,		// Sensor Range Minimum
-		100			// Sensor Range Maximum
-
-	};
-	
-	// Declare Output Variable
-	float Value_;
-	
-	// ************************************************************
-	// Set Sensor Configuration Byte
-	// ************************************************************
-	
-	// User Register Bit Definations
-	bool User_Reg_Bits_[8] = {false, false, false, false, false, false, false, false};
-	
-	// Set Resolution Bits
-	if (SHT21[0].Resolution == 14)	{ User_Reg_Bits_[7] = false	; User_Reg_Bits_[0] = false	;} // T: 14 bit
-	if (SHT21[0].Resolution == 12)	{ User_Reg_Bits_[7] = false	; User_Reg_Bits_[0] = true	;} // T: 12 bit
-	if (SHT21[0].Resolution == 13)	{ User_Reg_Bits_[7] = true	; User_Reg_Bits_[0] = false	;} // T: 13 bit
-	if (SHT21[0].Resolution == 11)	{ User_Reg_Bits_[7] = true	; User_Reg_Bits_[0] = true	;} // T: 11 bit
-	
-	// Set End of Battery Bits
-	if (SHT21[0].EoB == true) {User_Reg_Bits_[6] = true;} else {User_Reg_Bits_[6] = false;}
-	
-	// On Chip Heater Bits
-	if (SHT21[0].OCH == true) {User_Reg_Bits_[2] = true;} else {User_Reg_Bits_[2] = false;}
-	
-	// OTP Reload Bits
-	if (SHT21[0].OTP == true) {User_Reg_Bits_[1] = true;} else {User_Reg_Bits_[1] = false;}
-	
-	// User Register Defination
-	uint8_t User_Reg_ = 0x00;
-	
-	// Set Config Register
-	if (User_Reg_Bits_[0] == true) {User_Reg_ |= 0b00000001;} else {User_Reg_ &= 0b11111110;}	// User Register Bit 0
-	if (User_Reg_Bits_[1] == true) {User_Reg_ |= 0b00000010;} else {User_Reg_ &= 0b11111101;}	// User Register Bit 1
-	if (User_Reg_Bits_[2] == true) {User_Reg_ |= 0b00000100;} else {User_Reg_ &= 0b11111011;}	// User Register Bit 2
-	if (User_Reg_Bits_[3] == true) {User_Reg_ |= 0b00001000;} else {User_Reg_ &= 0b11110111;}	// User Register Bit 3
-	if (User_Reg_Bits_[4] == true) {User_Reg_ |= 0b00010000;} else {User_Reg_ &= 0b11101111;}	// User Register Bit 4
-	if (User_Reg_Bits_[5] == true) {User_Reg_ |= 0b00100000;} else {User_Reg_ &= 0b11011111;}	// User Register Bit 5
-	if (User_Reg_Bits_[6] == true) {User_Reg_ |= 0b01000000;} else {User_Reg_ &= 0b10111111;}	// User Register Bit 6
-	if (User_Reg_Bits_[7] == true) {User_Reg_ |= 0b10000000;} else {User_Reg_ &= 0b01111111;}	// User Register Bit 7
-	
-	// ************************************************************
-	// Reset Sensor
-	// ************************************************************
-	
-	// Send Soft Reset Command to SHT21
-	Wire.beginTransmission(0b01000000);
-	Wire.write(0b11111110);
-	
-	// Close I2C Connection
-	int SHT21_Reset = Wire.endTransmission(false);
-	
-	// Control For Reset Success
-	if (SHT21_Reset != 0) return(-101);
-	
-	// Software Reset Delay
-	delay(15);
-	
-	// ************************************************************
-	// Read Current Sensor Settings
-	// ************************************************************
-	
-	// Read User Register of SHT21
-	Wire.beginTransmission(0b01000000);
-	Wire.write(0b11100110);
-	Wire.requestFrom(0b01000000, 1);
-	uint8_t SHT21_Config_Read = Wire.read();
-	
-	// ************************************************************
-	// Write New Settings if Different
-	// ************************************************************
-	
-	// Control for Config Read Register
-	if (SHT21_Config_Read != User_Reg_) {
-		
-		// Write User Register of SHT21
-		Wire.beginTransmission(0b01000000);
-		Wire.write(0b11100110);
-		Wire.write(User_Reg_);
-		
-		// Close I2C Connection
-		int SHT21_Config = Wire.endTransmission(false);
-		
-		// Control For Command Success
-		if (SHT21_Config != 0) return(-102);
-		
 	}
-	
-	// ************************************************************
-	// Read Sensor Data
-	// ************************************************************
-		
-	// Define Measurement Read Array
-	float Measurement_Array[Read_Count_];
-
-	// Read Loop For Read Count
-	for (uint8_t Read_ID = 0; Read_ID < Read_Count_; Read_ID++) {
-	
-		// Send Read Command to SHT21
-		Wire.beginTransmission(0b01000000);
-		Wire.write(0b11100011);
-		
-		// Close I2C Connection
-		int SHT21_Read = Wire.endTransmission(false);
-		
-		// Control For Read Success
-		if (SHT21_Read != 0) return(-103);
-		
-		// Read Data Command to SHT21
-		Wire.requestFrom(0b01000000, 3);
-		
-		// Define Data Variable
-		uint8_t SHT21_Data[3];
-		
-		// Read I2C Bytes
-		SHT21_Data[0] = Wire.read(); // MSB
-		SHT21_Data[1] = Wire.read(); // LSB
-		SHT21_Data[2] = Wire.read(); // CRC
-		
-		// Combine Read Bytes
-		uint16_t Measurement_Raw = ((uint16_t)SHT21_Data[0] << 8) | (uint16_t)SHT21_Data[1];
-		
-		// Clear 2 Low Status Bit
-		if (SHT21[0].Resolution == 11) Measurement_Raw &= ~0x0006;
-		if (SHT21[0].Resolution == 12) Measurement_Raw &= ~0x0005;
-		if (SHT21[0].Resolution == 13) Measurement_Raw &= ~0x0004;
-		if (SHT21[0].Resolution == 14) Measurement_Raw &= ~0x0003;
-		
-		// Calculate Measurement
-		Measurement_Array[Read_ID] = -46.85 + 175.72 * (float)Measurement_Raw / pow(2,16);
-			
-	}
-	
-	// Calculate Data
-	DataSet_SHT21T.Array_Statistic(Measurement_Array,Read_Count_,Average_Type_);
 
-	// Get Average
-	Value_ = DataSet_SHT21T.Array_Average;
-	
-	// ************************************************************
-	// Control For Sensor Range
-	// ************************************************************
-	if (Value_ < SHT21[0].Range_Min or Value_ > SHT21[0].Range_Max) return(-106);
+}
+
+// Configuration Functions
+void Environment::Set_Address(const uint8_t Device_, const uint8_t Address_) {
+
+	// Control for Device
+	if (Device_ >= ENV_DEVICE_COUNT) return;
+
+	// Set Device Address
+	Driver(Device_).Set_Address(Address_);
+
+}
+void Environment::Set_Mux(const uint8_t Device_, const uint8_t Mux_Address_, const uint8_t Mux_Channel_) {
+
+	// Control for Device
+	if (Device_ >= ENV_DEVICE_COUNT) return;
+
+	// Set Multiplexer Channel
+	Driver(Device_).Set_Mux(Mux_Address_, Mux_Channel_);
+
+}
+void Environment::Set_Max_Clock(const uint8_t Device_, const uint32_t Max_Clock_) {
+
+	// Control for Device
+	if (Device_ >= ENV_DEVICE_COUNT) return;
+
+	// Set Device Clock Limit
+	Driver(Device_).Set_Max_Clock(Max_Clock_);
+
+}
+
+// Start Functions
+uint8_t Environment::Begin(void) {
 
-	// ************************************************************
-	// Calibrate Data
-	// ************************************************************
+	// Declare Started Device Mask
+	uint8_t Started_ = 0;
 
-	Value_ = (SHT21_T_Calibrarion_a * Value_) + SHT21_T_Calibrarion_b;
+	// Start Devices
+	if (SHT21.Begin()) Started_ |= (1 << ENV_SHT21);
+	if (HDC2010.Begin()) Started_ |= (1 << ENV_HDC2010);
+	if (MPL3115A2.Begin()) Started_ |= (1 << ENV_MPL3115A2);
+	if (TSL2561.Begin()) Started_ |= (1 << ENV_TSL2561);
 
 	// End Function
-	return(Value_);
+	return(Started_);
+
+}
+uint8_t Environment::Start_State(const uint8_t Device_) {
+
+	// Control for Device
+	if (Device_ >= ENV_DEVICE_COUNT) return(ENV_START_NONE);
+
+	// Get Driver Start State
+	return(Driver(Device_).Start_State());
+
+}
+uint32_t Environment::First_Reading_Time(const uint8_t Device_) {
+
+	// Control for Device
+	if (Device_ >= ENV_DEVICE_COUNT) return(0);
+
+	// Get Driver Time to First Valid Reading
+	return(Driver(Device_).First_Reading_Time());
+
+}
+uint16_t Environment::Failures(const uint8_t Device_) {
+
+	// Control for Device
+	if (Device_ >= ENV_DEVICE_COUNT) return(0);
+
+	// Get Device Failure Counter
+	return(Driver(Device_).Failure_Count());
+
+}
+
+// Sensor Functions
+float Environment::SHT21_Temperature(const uint8_t Read_Count_, const uint8_t Average_Type_) {
+
+	// Control for Fresh Reading
+	if (Cache.Fresh(ENV_SHT21_TEMPERATURE)) return(Cache.Get(ENV_SHT21_TEMPERATURE).Value);
+
+	// Measure and Store
+	Summary_Reset();
+	return(Store(ENV_SHT21_TEMPERATURE, SHT21.Temperature(Read_Count_, Average_Type_, &Adaptive[ENV_SHT21_TEMPERATURE], &Measurement, Resolution[ENV_SHT21_TEMPERATURE]), Resolution[ENV_SHT21_TEMPERATURE]));
 
 }
 float Environment::SHT21_Humidity(const uint8_t Read_Count_, const uint8_t Average_Type_) {
-	
-	/******************************************************************************
-	 *	Project		: SHT21 Humidity Read Function
-	 *	Developer	: Mehmet Gunce Akkoyun (akkoyun@me.com)
-	 *	Revision	: 04.00.00
-	 *	Release		: 04.11.2020
-	 ******************************************************************************/
-	
-	// Set Sensor Definations
-	struct Sensor_Settings {
-		int 	Resolution;
-		bool	EoB;
-		bool	OCH;
-		bool	OTP;
-		int		Range_Min;
-		int		Range_Max;
-		
-	};
-	Sensor_Settings SHT21[] {
-		
-		12,			// Measurement Resolution
-		false,		// Sensor End of Battery Setting
-		false,		// On Chip Heater Setting
-		false,		// OTP Read
-		0,			// Sensor Range Minimum
-		100			// Sensor Range Maximum
-
-	};
-
-	// Declare Output Variable
-	float Value_;
 
-	// ************************************************************
-	// Set Sensor Configuration Byte
-	// ************************************************************
-	
-	// User Register Bit Definations
-	bool User_Reg_Bits_[8] = {false, false, false, false, false, false, false, false};
-	
-	// Set Resolution Bits
-	if (SHT21[0].Resolution == 12)	{ User_Reg_Bits_[7] = false	; User_Reg_Bits_[0] = false	;} // T: 12 bit
-	if (SHT21[0].Resolution == 11)	{ User_Reg_Bits_[7] = true	; User_Reg_Bits_[0] = true	;} // T: 11 bit
-	if (SHT21[0].Resolution == 10)	{ User_Reg_Bits_[7] = true	; User_Reg_Bits_[0] = false	;} // T: 10 bit
-	if (SHT21[0].Resolution == 8)	{ User_Reg_Bits_[7] = false	; User_Reg_Bits_[0] = true	;} // T: 08 bit
-	
-	// Set End of Battery Bits
-	if (SHT21[0].EoB == true) {User_Reg_Bits_[6] = true;} else {User_Reg_Bits_[6] = false;}
-	
-	// On Chip Heater Bits
-	if (SHT21[0].OCH == true) {User_Reg_Bits_[2] = true;} else {User_Reg_Bits_[2] = false;}
-	
-	// OTP Reload Bits
-	if (SHT21[0].OTP == true) {User_Reg_Bits_[1] = true;} else {User_Reg_Bits_[1] = false;}
-	
-	// User Register Defination
-	uint8_t User_Reg_ = 0x00;
-	
-	// Set Config Register
-	if (User_Reg_Bits_[0] == true) {User_Reg_ |= 0b00000001;} else {User_Reg_ &= 0b11111110;}	// User Register Bit 0
-	if (User_Reg_Bits_[1] == true) {User_Reg_ |= 0b00000010;} else {User_Reg_ &= 0b11111101;}	// User Register Bit 1
-	if (User_Reg_Bits_[2] == true) {User_Reg_ |= 0b00000100;} else {User_Reg_ &= 0b11111011;}	// User Register Bit 2
-	if (User_Reg_Bits_[3] == true) {User_Reg_ |= 0b00001000;} else {User_Reg_ &= 0b11110111;}	// User Register Bit 3
-	if (User_Reg_Bits_[4] == true) {User_Reg_ |= 0b00010000;} else {User_Reg_ &= 0b11101111;}	// User Register Bit 4
-	if (User_Reg_Bits_[5] == true) {User_Reg_ |= 0b00100000;} else {User_Reg_ &= 0b11011111;}	// User Register Bit 5
-	if (User_Reg_Bits_[6] == true) {User_Reg_ |= 0b01000000;} else {User_Reg_ &= 0b10111111;}	// User Register Bit 6
-	if (User_Reg_Bits_[7] == true) {User_Reg_ |= 0b10000000;} else {User_Reg_ &= 0b01111111;}	// User Register Bit 7
-	
-	// ************************************************************
-	// Reset Sensor
-	// ************************************************************
-	
-	// Send Soft Reset Command to SHT21
-	Wire.beginTransmission(0b01000000);
-	Wire.write(0b11111110);
-	
-	// Close I2C Connection
-	int SHT21_Reset = Wire.endTransmission(false);
-	
-	// Control For Reset Success
-	if (SHT21_Reset != 0) return(-101);
-	
-	// Software Reset Delay
-	delay(15);
-	
-	// ************************************************************
-	// Read Current Sensor Settings
-	// ************************************************************
-	
-	// Read User Register of SHT21
-	Wire.beginTransmission(0b01000000);
-	Wire.write(0b11100110);
-	Wire.requestFrom(0b01000000, 1);
-	uint8_t SHT21_Config_Read = Wire.read();
-	
-	// ************************************************************
-	// Write New Settings if Different
-	// ************************************************************
-	
-	// Control for Config Read Register
-	if (SHT21_Config_Read != User_Reg_) {
-		
-		// Write User Register of SHT21
-		Wire.beginTransmission(0b01000000);
-		Wire.write(0b11100110);
-		Wire.write(User_Reg_);
-		
-		// Close I2C Connection
-		int SHT21_Config = Wire.endTransmission(false);
-		
-		// Control For Command Success
-		if (SHT21_Config != 0) return(-102);
-		
-	}
+	// Control for Fresh Reading
+	if (Cache.Fresh(ENV_SHT21_HUMIDITY)) return(Cache.Get(ENV_SHT21_HUMIDITY).Value);
 
-	// ************************************************************
-	// Read Sensor Data
-	// ************************************************************
-		
-	// Define Measurement Read Array
-	float Measurement_Array[Read_Count_];
-
-	// Read Loop For Read Count
-	for (uint8_t Read_ID = 0; Read_ID < Read_Count_; Read_ID++) {
-	
-		// Send Read Command to SHT21
-		Wire.beginTransmission(0b01000000);
-		Wire.write(0b11100101);
-
-		// Close I2C Connection
-		int SHT21_Read = Wire.endTransmission(false);
-		
-		// Control For Read Success
-		if (SHT21_Read != 0) return(-103);
-		
-		// Read Data Command to SHT21
-		Wire.requestFrom(0b01000000, 3);
-		
-		// Define Data Variable
-		uint8_t SHT21_Data[3];
-		
-		// Read I2C Bytes
-		SHT21_Data[0] = Wire.read(); // MSB
-		SHT21_Data[1] = Wire.read(); // LSB
-		SHT21_Data[2] = Wire.read(); // CRC
-
-		// Combine Read Bytes
-		uint16_t Measurement_Raw = ((uint16_t)SHT21_Data[0] << 8) | (uint16_t)SHT21_Data[1];
-				
-		// Calculate Measurement
-		Measurement_Array[Read_ID] = -6 + 125 * (float)Measurement_Raw / pow(2,16);
-			
-	}
-	
-	// Calculate Data
-	DataSet_SHT21H.Array_Statistic(Measurement_Array,Read_Count_,Average_Type_);
+	// Measure and Store
+	Summary_Reset();
+	return(Store(ENV_SHT21_HUMIDITY, SHT21.Humidity(Read_Count_, Average_Type_, &Adaptive[ENV_SHT21_HUMIDITY], &Measurement, Resolution[ENV_SHT21_HUMIDITY]), Resolution[ENV_SHT21_HUMIDITY]));
+
+}
+bool Environment::SHT21_Read(float & Temperature_, float & Humidity_, float * Compensated_) {
+
+	// Control for Fresh Readings (both channels)
+	if (Cache.Fresh(ENV_SHT21_TEMPERATURE) and Cache.Fresh(ENV_SHT21_HUMIDITY)) {
+
+		// Get Cached Readings
+		Temperature_ = Cache.Get(ENV_SHT21_TEMPERATURE).Value;
+		Humidity_ = Cache.Get(ENV_SHT21_HUMIDITY).Value;
 
-	// Get Average
-	Value_ = DataSet_SHT21H.Array_Average;
+	} else {
 
-	// ************************************************************
-	// Control For Sensor Range
-	// ************************************************************
-	
-	if (Value_ < SHT21[0].Range_Min or Value_ > SHT21[0].Range_Max) return(-106);
+		// Measure Pipelined Pair
+		SHT21.Read(Temperature_, Humidity_, Resolution[ENV_SHT21_TEMPERATURE], Resolution[ENV_SHT21_HUMIDITY]);
 
-	// ************************************************************
-	// Calibrate Data
-	// ************************************************************
+		// Store Readings
+		Summary_Reset();
+		Temperature_ = Store(ENV_SHT21_TEMPERATURE, Temperature_, Resolution[ENV_SHT21_TEMPERATURE]);
+		Summary_Reset();
+		Humidity_ = Store(ENV_SHT21_HUMIDITY, Humidity_, Resolution[ENV_SHT21_HUMIDITY]);
+
+	}
+
+	// Set Compensated Humidity
+	if (Compensated_ != NULL) *Compensated_ = Environment_SHT21::Compensate(Temperature_, Humidity_);
 
-	Value_ = (SHT21_H_Calibrarion_a * Value_) + SHT21_H_Calibrarion_b;
-	
 	// End Function
-	return(Value_);
+	return(Temperature_ > ENV_ERROR_LIMIT and Humidity_ > ENV_ERROR_LIMIT);
 
 }
 float Environment::HDC2010_Temperature(const uint8_t Read_Count_, const uint8_t Average_Type_) {
 
-	/******************************************************************************
-	 *	Project		: HDC2010 Sensor Read Function
-	 *	Developer	: Mehmet Gunce Akkoyun (akkoyun@me.com)
-	 *	Revision	: 02.00.00
-	 *	Release		: 04.11.2020
-	 ******************************************************************************/
-
-	// Set Sensor Definations
-	struct Sensor {
-		float		Range_Min;
-		float		Range_Max;
-		uint8_t		Measurement_Rate;
-		uint8_t		Resolution_Temperature;
-		uint8_t		Resolution_Humidity;
-		bool		Sensor_Reset;
-		
-	};
-	Sensor HDC2010[] {
-		
-		-40,		// [Range_Min]
-		125,		// [Range_Max]
-		0,			// [Measurement_Rate]
-		9,			// [Resolution_Temperature]
-		9,			// [Resolution_Humidity]
-		true,		// [Sensor_Reset]
-
-	};
-
-	// Declare Output Variable
-	float Value_;
+	// Control for Fresh Reading
+	if (Cache.Fresh(ENV_HDC2010_TEMPERATURE)) return(Cache.Get(ENV_HDC2010_TEMPERATURE).Value);
+
+	// Measure and Store
+	Summary_Reset();
+	return(Store(ENV_HDC2010_TEMPERATURE, HDC2010.Temperature(Read_Count_, Average_Type_, &Adaptive[ENV_HDC2010_TEMPERATURE], &Measurement, Resolution[ENV_HDC2010_TEMPERATURE]), Resolution[ENV_HDC2010_TEMPERATURE]));
+
+}
+float Environment::HDC2010_Humidity(const uint8_t Read_Count_, const uint8_t Average_Type_) {
+
+	// Control for Fresh Reading
+	if (Cache.Fresh(ENV_HDC2010_HUMIDITY)) return(Cache.Get(ENV_HDC2010_HUMIDITY).Value);
+
+	// Measure and Store
+	Summary_Reset();
+	return(Store(ENV_HDC2010_HUMIDITY, HDC2010.Humidity(Read_Count_, Average_Type_, &Adaptive[ENV_HDC2010_HUMIDITY], &Measurement, Resolution[ENV_HDC2010_HUMIDITY]), Resolution[ENV_HDC2010_HUMIDITY]));
+
+}
+float Environment::MPL3115A2_Pressure(void) {
+
+	// Control for Fresh Reading
+	if (Cache.Fresh(ENV_MPL3115A2_PRESSURE)) return(Cache.Get(ENV_MPL3115A2_PRESSURE).Value);
+
+	// Measure and Store
+	Summary_Reset();
+	return(Store(ENV_MPL3115A2_PRESSURE, MPL3115A2.Pressure()));
+
+}
+float Environment::TSL2561_Light(void) {
+
+	// Control for Fresh Reading
+	if (Cache.Fresh(ENV_TSL2561_LIGHT)) return(Cache.Get(ENV_TSL2561_LIGHT).Value);
+
+	// Measure and Store
+	Summary_Reset();
+	return(Store(ENV_TSL2561_LIGHT, TSL2561.Light()));
+
+}
+
+// Generic Read Functions
+float Environment::Read(const uint8_t Channel_, const uint8_t Read_Count_, const uint8_t Average_Type_) {
+
+	// Read Channel
+	switch (Channel_) {
+
+		case ENV_SHT21_TEMPERATURE:		return(SHT21_Temperature(Read_Count_, Average_Type_));
+		case ENV_SHT21_HUMIDITY:		return(SHT21_Humidity(Read_Count_, Average_Type_));
+		case ENV_HDC2010_TEMPERATURE:	return(HDC2010_Temperature(Read_Count_, Average_Type_));
+		case ENV_HDC2010_HUMIDITY:		return(HDC2010_Humidity(Read_Count_, Average_Type_));
+		case ENV_MPL3115A2_PRESSURE:	return(MPL3115A2_Pressure());
+		case ENV_TSL2561_LIGHT:			return(TSL2561_Light());
+		default:						return(-100);
 
-	// ************************************************************
-	// Reset Sensor
-	// ************************************************************
-
-	// Reset Sensor
-	if (HDC2010[0].Sensor_Reset == true) {
-		
-		// ************************************************************
-		// Read Current Sensor Settings
-		// ************************************************************
-		
-		// Read User Register of HDC2010
-		Wire.beginTransmission(0x40);
-		Wire.write(0x0E);
-		Wire.requestFrom(0x40, 0x01);
-		uint8_t HDC2010_Reset_Read = Wire.read();
-
-		// ************************************************************
-		// Reset Sensor
-		// ************************************************************
-		
-		// Set Reset Bit
-		HDC2010_Reset_Read = (HDC2010_Reset_Read | 0b10000000);
-		
-		// Send Soft Reset Command to HDC2010
-		Wire.beginTransmission(0x40);
-		
-		// Set Address
-		Wire.write(0x0E);
-
-		// Send Data
-		Wire.write(HDC2010_Reset_Read);
-		
-		// Close I2C Connection
-		uint8_t HDC2010_Reset = Wire.endTransmission(false);
-		
-		// Control For Reset Success
-		if (HDC2010_Reset != 0) return (-101);
-		
-		// Software Reset Delay
-		delay(10);
-		
-	}
-	
-	// ************************************************************
-	// Read Current Sensor Settings
-	// ************************************************************
-	
-	// Connect to Sensor
-	Wire.beginTransmission(0x40);
-	
-	// Set Register Read (Config)
-	Wire.write(0x0E);
-
-	// Request Data
-	Wire.requestFrom(0x40, 0x01);
-
-	// Read Register
-	uint8_t HDC2010_Config_Read = Wire.read();
-
-	// delay
-	delay(5);
-
-	// Connect to Sensor
-	Wire.beginTransmission(0x40);
-
-	// Set Register Read (Config_Read)
-	Wire.write(0x0F);
-
-	// Request Data
-	Wire.requestFrom(0x40, 0x01);
-
-	// Read Register
-	uint8_t HDC2010_MeasurementConfig_Read = Wire.read();
-
-	// ************************************************************
-	// Set Sensor Configurations
-	// ************************************************************
-
-	// Set Measurement Mode
-	HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xFC);
-	HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x02);
-
-	// Set Measurement Rate
-	switch(HDC2010[0].Measurement_Rate) {
-
-		case 0:	// Manual
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0x8F);
-			break;
-			
-		case 1:	// 2 Minutes
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0x9F);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x10);
-			break;
-			
-		case 2:	// 1 Minutes
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0xAF);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x20);
-			break;
-		
-		case 3:	// 10 Second
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0xBF);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x30);
-			break;
-		
-		case 4:	// 5 Second
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0xCF);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x40);
-			break;
-		
-		case 5:	// 1 Second
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0xDF);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x50);
-			break;
-		
-		case 6:	// 0.5 Second
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0xEF);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x60);
-			break;
-		
-		case 7:	// 0.2 Second
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x70);
-			break;
-			
-		default:
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0x8F);
-		
-	}
-	
-	// Set Temperature Resolution
-	switch(HDC2010[0].Resolution_Temperature) {
-		
-		case 14:	// 14 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0x3F);
-			break;
-			
-		case 11:	// 11 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0x7F);
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x40);
-			break;
-			
-		case 9:		// 9 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xBF);
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x80);
-			break;
-			
-		default:
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0x3F);
-			
 	}
 
-	// Set Humidity Resolution
-	switch(HDC2010[0].Resolution_Humidity) {
-		
-		case 14:	// 14 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xCF);
-			break;
-			
-		case 11:	// 11 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xDF);
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x10);
-			break;
-			
-		case 9:		// 9 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xEF);
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x20);
-			break;
-			
-		default:
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xCF);
-			
+}
+uint8_t Environment::Channel_Device(const uint8_t Channel_) {
+
+	// Map Channel to Device
+	switch (Channel_) {
+
+		case ENV_SHT21_TEMPERATURE:
+		case ENV_SHT21_HUMIDITY:		return(ENV_SHT21);
+		case ENV_HDC2010_TEMPERATURE:
+		case ENV_HDC2010_HUMIDITY:		return(ENV_HDC2010);
+		case ENV_MPL3115A2_PRESSURE:	return(ENV_MPL3115A2);
+		case ENV_TSL2561_LIGHT:			return(ENV_TSL2561);
+		default:						return(ENV_DEVICE_COUNT);
+
 	}
 
-	// Trigger Measurement
-	HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x01);
-
-	// ************************************************************
-	// Read Temperature
-	// ************************************************************
-
-	// Define Measurement Read Array
-	float Measurement_Array[Read_Count_];
-
-	// Read Loop For Read Count
-	for (int Read_ID = 0; Read_ID < Read_Count_; Read_ID++) {
-
-		// ************************************************************
-		// Write Sensor Configurations
-		// ************************************************************
-
-		// Connect to Sensor
-		Wire.beginTransmission(0x40);
-		
-		// Set Register
-		Wire.write(0x0E);
-
-		// Send Data
-		Wire.write(HDC2010_Config_Read);
-
-		// Close I2C Connection
-		uint8_t HDC2010_Config = Wire.endTransmission(false);
-		
-		// Control For Write Success
-		if (HDC2010_Config != 0) return (-102);
-
-		// delay
-		delay(5);
-
-		// Send Mode Command to HDC2010
-		Wire.beginTransmission(0x40);
-		
-		// Set Address
-		Wire.write(0x0F);
-
-		// Send Data
-		Wire.write(HDC2010_MeasurementConfig_Read);
-
-		// Close I2C Connection
-		uint8_t HDC2010_Measurement_Config = Wire.endTransmission(false);
-		
-		// Control For Write Success
-		if (HDC2010_Measurement_Config != 0) return (-103);
-
-		// Define Variables
-		uint8_t HDC2010_Data[2];
-			
-		// Read Delay
-		delay(5);
-
-		// ************************************************************
-		// Read Temperature LSB Data
-		// ************************************************************
-
-		// Connect to Sensor
-		Wire.beginTransmission(0x40);
-
-		// Set Register // LSB Temperature
-		Wire.write(0x00);
-
-		// Close I2C Connection
-		uint8_t HDC2010_Measurement_Low_Read = Wire.endTransmission(false);
-
-		// Control For Read Success
-		if (HDC2010_Measurement_Low_Read != 0) return (-104);
-			
-		// Read LSB Data from HDC2010
-		Wire.requestFrom(0x40, 0x01);
-			
-		// Read Data
-		HDC2010_Data[0] = Wire.read(); // LSB Data
-			
-		// ************************************************************
-		// Read Temperature MSB Data
-		// ************************************************************
-
-		// Connect to Sensor
-		Wire.beginTransmission(0x40);
-
-		// Set Register // MSB Temperature
-		Wire.write(0x01);
-
-		// Close I2C Connection
-		uint8_t HDC2010_Measurement_High_Read = Wire.endTransmission(false);
-
-		// Control For Read Success
-		if (HDC2010_Measurement_High_Read != 0) return (-105);
-					
-		// Read MSB Data from HDC2010
-		Wire.requestFrom(0x40, 0x01);
-					
-		// Read Data
-		HDC2010_Data[1] = Wire.read(); // MSB Data
-
-		// ************************************************************
-		// Combine Data
-		// ************************************************************
-
-		// Combine Read Bytes
-		uint16_t Measurement_Raw = ((uint16_t)(HDC2010_Data[1]) << 8 | (uint16_t)HDC2010_Data[0]);
-
-		// Calculate Measurement
-		Measurement_Array[Read_ID] = (float)Measurement_Raw * 165 / 65536 - 40;
-		
+}
+
+// Power Functions
+uint8_t Environment::Power_Down(const uint8_t Device_) {
+
+	// Set Lowest Power State
+	switch (Device_) {
+
+		case ENV_SHT21:		return(SHT21.Power_Down());
+		case ENV_HDC2010:	return(HDC2010.Power_Down());
+		case ENV_MPL3115A2:	return(MPL3115A2.Power_Down());
+		case ENV_TSL2561:	return(TSL2561.Power_Down());
+		default:			return(ENV_BUS_OK);
+
 	}
-	
-	// Calculate Data
-	DataSet_HDC2010T.Array_Statistic(Measurement_Array,Read_Count_,Average_Type_);
 
-	// Get Average
-	Value_ = DataSet_HDC2010T.Array_Average;
+}
+
+// Asynchronous Read Functions
+bool Environment::Start(const uint8_t Channel_, const bool Force_) {
+
+	// Get Device
+	uint8_t Device_ = Channel_Device(Channel_);
+
+	// Control for Channel
+	if (Device_ >= ENV_DEVICE_COUNT) return(false);
+
+	// Control for Device Job (one conversion per device)
+	if (Job[Device_].Status == ENV_ASYNC_QUEUED or Job[Device_].Status == ENV_ASYNC_WAIT) return(false);
 
-	// ************************************************************
-	// Control For Sensor Range
-	// ************************************************************
-	if (Value_ < HDC2010[0].Range_Min or Value_ > HDC2010[0].Range_Max) return(-106);
+	// Control for Fresh Reading (ready without bus traffic unless forced)
+	if (!Force_ and Cache.Fresh(Channel_)) return(true);
 
-	// ************************************************************
-	// Calibrate Data
-	// ************************************************************
+	// Find First Step of Channel
+	for (uint8_t i = 0; i < ENV_ASYNC_STEP_COUNT; i++) {
 
-	Value_ = (HDC2010_T_Calibrarion_a * Value_) + HDC2010_T_Calibrarion_b;
+		// Control for Channel
+		if (pgm_read_byte(&ENV_ASYNC_STEP[i].Channel) != Channel_) continue;
+
+		// Set Job
+		Job_Channel[Device_] = Channel_;
+		Job_Step[Device_] = i;
+
+		// Submit First Step
+		if (!Async_Submit(Device_)) return(false);
+
+		// Set Pending
+		Async_Pending |= (1 << Channel_);
+
+		// End Function
+		return(true);
+
+	}
 
 	// End Function
-	return(Value_);
-		
+	return(false);
+
 }
-float Environment::HDC2010_Humidity(const uint8_t Read_Count_, const uint8_t Average_Type_) {
+bool Environment::Ready(const uint8_t Channel_) {
 
-	/******************************************************************************
-	 *	Project		: HDC2010 Sensor Read Function
-	 *	Developer	: Mehmet Gunce Akkoyun (akkoyun@me.coj)
-	 *	Revision	: 02.00.00
-	 *	Release		: 04.11.2020
-	 ******************************************************************************/
-
-	// Set Sensor Definations
-	struct Sensor {
-		float		Range_Min;
-		float		Range_Max;
-		uint8_t		Measurement_Rate;
-		uint8_t		Resolution_Temperature;
-		uint8_t		Resolution_Humidity;
-		bool		Sensor_Reset;
-
-	};
-	Sensor HDC2010[] {
-		
-		0,			// [Range_Min]
-		100,		// [Range_Max]
-		5,			// [Measurement_Rate]
-		14,			// [Resolution_Temperature]
-		14,			// [Resolution_Humidity]
-		true,		// [Sensor_Reset]
-		
-	};
-
-	// Declare Output Variable
-	float Value_;
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return(false);
+
+	// End Function
+	return((Async_Pending & (1 << Channel_)) == 0);
+
+}
+void Environment::Poll(void) {
+
+	// Run Queue
+	Queue->Poll();
+
+}
+void Environment::Set_Callback(void (*Callback_)(const uint8_t Channel_, const float Value_)) {
+
+	// Set Completion Callback
+	Async_Callback = Callback_;
+
+}
+bool Environment::Async_Submit(const uint8_t Device_) {
+
+	// Read Step From Flash
+	Environment_Step Step_;
+	memcpy_P(&Step_, &ENV_ASYNC_STEP[Job_Step[Device_]], sizeof(Environment_Step));
+
+	// Set Descriptor
+	for (uint8_t i = 0; i < ENV_ASYNC_COMMAND_SIZE; i++) Job[Device_].Command[i] = Step_.Command[i];
+	Job[Device_].Command_Length = Step_.Command_Length;
+	Job[Device_].Wait = Step_.Wait;
+	Job[Device_].Register = Step_.Register;
+	Job[Device_].Data = &Job_Data[Device_][Step_.Offset];
+	Job[Device_].Length = Step_.Length;
+	Job[Device_].Retry = Step_.Retry;
+
+	// Submit Descriptor
+	return(Queue->Submit(Job[Device_]));
+
+}
+void Environment::Async_Complete(Environment_Transaction * Transaction_) {
+
+	// Get Owner
+	Environment * Owner_ = (Environment *)Transaction_->Context;
+
+	// Get Device
+	uint8_t Device_ = Transaction_ - Owner_->Job;
+	uint8_t Channel_ = Owner_->Job_Channel[Device_];
+
+	// Control for More Steps
+	if (Transaction_->Status == ENV_ASYNC_DONE) {
+
+		// Next Step
+		uint8_t Next_ = Owner_->Job_Step[Device_] + 1;
+
+		// Submit Next Step of Channel
+		if (Next_ < ENV_ASYNC_STEP_COUNT and pgm_read_byte(&ENV_ASYNC_STEP[Next_].Channel) == Channel_) {
+
+			// Set Step
+			Owner_->Job_Step[Device_] = Next_;
+
+			// Submit Step
+			if (Owner_->Async_Submit(Device_)) return;
+
+			// Queue Rejected Step
+			Transaction_->Status = ENV_ASYNC_ERROR;
+
+		}
 
-	// ************************************************************
-	// Reset Sensor
-	// ************************************************************
-
-	// Reset Sensor
-	if (HDC2010[0].Sensor_Reset == true) {
-		
-		// ************************************************************
-		// Read Current Sensor Settings
-		// ************************************************************
-		
-		// Read User Register of HDC2010
-		Wire.beginTransmission(0x40);
-		Wire.write(0x0E);
-		Wire.requestFrom(0x40, 0x01);
-		uint8_t HDC2010_Reset_Read = Wire.read();
-
-		// ************************************************************
-		// Reset Sensor
-		// ************************************************************
-		
-		// Set Reset Bit
-		HDC2010_Reset_Read = (HDC2010_Reset_Read | 0b10000000);
-		
-		// Send Soft Reset Command to HDC2010
-		Wire.beginTransmission(0x40);
-		
-		// Set Address
-		Wire.write(0x0E);
-
-		// Send Data
-		Wire.write(HDC2010_Reset_Read);
-		
-		// Close I2C Connection
-		uint8_t HDC2010_Reset = Wire.endTransmission(false);
-		
-		// Control For Reset Success
-		if (HDC2010_Reset != 0) return (-101);
-		
-		// Software Reset Delay
-		delay(10);
-		
-	}
-	
-	// ************************************************************
-	// Read Current Sensor Settings
-	// ************************************************************
-	
-	// Connect to Sensor
-	Wire.beginTransmission(0x40);
-	
-	// Set Register Read (Config)
-	Wire.write(0x0E);
-
-	// Request Data
-	Wire.requestFrom(0x40, 0x01);
-
-	// Read Register
-	uint8_t HDC2010_Config_Read = Wire.read();
-
-	// delay
-	delay(5);
-
-	// Connect to Sensor
-	Wire.beginTransmission(0x40);
-
-	// Set Register Read (Config_Read)
-	Wire.write(0x0F);
-
-	// Request Data
-	Wire.requestFrom(0x40, 0x01);
-
-	// Read Register
-	uint8_t HDC2010_MeasurementConfig_Read = Wire.read();
-
-	// ************************************************************
-	// Set Sensor Configurations
-	// ************************************************************
-
-	// Set Measurement Mode
-	HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xFD);
-	HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x04);
-
-	// Set Measurement Rate
-	switch(HDC2010[0].Measurement_Rate) {
-
-		case 0:	// Manual
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0x8F);
-			break;
-			
-		case 1:	// 2 Minutes
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0x9F);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x10);
-			break;
-			
-		case 2:	// 1 Minutes
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0xAF);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x20);
-			break;
-		
-		case 3:	// 10 Second
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0xBF);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x30);
-			break;
-		
-		case 4:	// 5 Second
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0xCF);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x40);
-			break;
-		
-		case 5:	// 1 Second
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0xDF);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x50);
-			break;
-		
-		case 6:	// 0.5 Second
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0xEF);
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x60);
-			break;
-		
-		case 7:	// 0.2 Second
-			HDC2010_Config_Read = (HDC2010_Config_Read | 0x70);
-			break;
-			
-		default:
-			HDC2010_Config_Read = (HDC2010_Config_Read & 0x8F);
-		
-	}
-	
-	// Set Temperature Resolution
-	switch(HDC2010[0].Resolution_Temperature) {
-		
-		case 14:	// 14 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0x3F);
-			break;
-			
-		case 11:	// 11 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0x7F);
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x40);
-			break;
-			
-		case 9:		// 9 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xBF);
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x80);
-			break;
-			
-		default:
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0x3F);
-			
 	}
 
-	// Set Humidity Resolution
-	switch(HDC2010[0].Resolution_Humidity) {
-		
-		case 14:	// 14 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xCF);
-			break;
-			
-		case 11:	// 11 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xDF);
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x10);
-			break;
-			
-		case 9:		// 9 Bit
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xEF);
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x20);
-			break;
-			
+	// Convert and Store
+	Owner_->Summary_Reset();
+	float Value_ = Owner_->Store(Channel_, (Transaction_->Status == ENV_ASYNC_DONE) ? Owner_->Async_Value(Device_) : ENV_ERROR_BUS);
+
+	// Clear Pending
+	Owner_->Async_Pending &= ~(1 << Channel_);
+
+	// Call User Callback
+	if (Owner_->Async_Callback != NULL) Owner_->Async_Callback(Channel_, Value_);
+
+}
+float Environment::Async_Value(const uint8_t Device_) {
+
+	// Declare Variables
+	uint8_t * Data_ = Job_Data[Device_];
+	float Value_;
+
+	// Convert Descriptor Channels
+	const Environment_Descriptor * Descriptor_ = Descriptor(Job_Channel[Device_]);
+	if (Descriptor_ != NULL) return(Environment_Acquisition::Value(Descriptor_, Data_));
+
+	// Convert Job Data
+	switch (Job_Channel[Device_]) {
+
+		case ENV_MPL3115A2_PRESSURE:
+
+			// Control for Pressure Data Ready
+			if ((Data_[0] & 0b00000100) == 0) return(-106);
+
+			// Calculate Pressure (mBar)
+			Value_ = (ENV_MPL3115A2_P_CALIBRATION_A * ((float)((((uint32_t)Data_[1] << 16) | ((uint32_t)Data_[2] << 8) | Data_[3]) >> 4) / 4.00 / 100)) + ENV_MPL3115A2_P_CALIBRATION_B;
+
+			// Control For Sensor Range
+			if (Value_ <= 500 or Value_ >= 11000) return(-108);
+
+			// End Function
+			return(Value_);
+
+		case ENV_TSL2561_LIGHT:
+
+			// Calculate Lux (13.7 ms, high gain as set by first step)
+			return(Environment_TSL2561::Lux(((uint16_t)Data_[1] << 8) | Data_[0], ((uint16_t)Data_[3] << 8) | Data_[2], 1, 1));
+
 		default:
-			HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read & 0xCF);
-			
-	}
 
-	// Trigger Measurement
-	HDC2010_MeasurementConfig_Read = (HDC2010_MeasurementConfig_Read | 0x01);
-	
-	// ************************************************************
-	// Read Temperature
-	// ************************************************************
-
-	// Define Measurement Read Array
-	float Measurement_Array[Read_Count_];
-
-	// Read Loop For Read Count
-	for (int Read_ID = 0; Read_ID < Read_Count_; Read_ID++) {
-
-		// ************************************************************
-		// Write Sensor Configurations
-		// ************************************************************
-
-		// Connect to Sensor
-		Wire.beginTransmission(0x40);
-		
-		// Set Register
-		Wire.write(0x0E);
-
-		// Send Data
-		Wire.write(HDC2010_Config_Read);
-
-		// Close I2C Connection
-		uint8_t HDC2010_Config = Wire.endTransmission(false);
-		
-		// Control For Write Success
-		if (HDC2010_Config != 0) return (-102);
-
-		// delay
-		delay(5);
-
-		// Send Mode Command to HDC2010
-		Wire.beginTransmission(0x40);
-		
-		// Set Address
-		Wire.write(0x0F);
-
-		// Send Data
-		Wire.write(HDC2010_MeasurementConfig_Read);
-
-		// Close I2C Connection
-		uint8_t HDC2010_Measurement_Config = Wire.endTransmission(false);
-		
-		// Control For Write Success
-		if (HDC2010_Measurement_Config != 0) return (-103);
-
-		// Define Variables
-		uint8_t HDC2010_Data[2];
-			
-		// Read Delay
-		delay(5);
-
-		// ************************************************************
-		// Read Humidity LSB Data
-		// ************************************************************
-
-		// Connect to Sensor
-		Wire.beginTransmission(0x40);
-
-		// Set Register // LSB Humidity
-		Wire.write(0x02);
-
-		// Close I2C Connection
-		uint8_t HDC2010_Measurement_Low_Read = Wire.endTransmission(false);
-
-		// Control For Read Success
-		if (HDC2010_Measurement_Low_Read != 0) return (-104);
-			
-		// Read LSB Data from HDC2010
-		Wire.requestFrom(0x40, 0x01);
-			
-		// Read Data
-		HDC2010_Data[0] = Wire.read(); // LSB Data
-			
-		// ************************************************************
-		// Read Humidity MSB Data
-		// ************************************************************
-
-		// Connect to Sensor
-		Wire.beginTransmission(0x40);
-
-		// Set Register // MSB Humidity
-		Wire.write(0x03);
-
-		// Close I2C Connection
-		uint8_t HDC2010_Measurement_High_Read = Wire.endTransmission(false);
-
-		// Control For Read Success
-		if (HDC2010_Measurement_High_Read != 0) return (-105);
-					
-		// Read MSB Data from HDC2010
-		Wire.requestFrom(0x40, 0x01);
-					
-		// Read Data
-		HDC2010_Data[1] = Wire.read(); // MSB Data
-
-		// ************************************************************
-		// Combine Data
-		// ************************************************************
-
-		// Combine Read Bytes
-		uint16_t Measurement_Raw = ((uint16_t)(HDC2010_Data[1]) << 8 | (uint16_t)HDC2010_Data[0]);
-
-		// Calculate Measurement
-		Measurement_Array[Read_ID] = (float)Measurement_Raw / 65536 * 100;
-		
+			// End Function
+			return(-100);
+
 	}
-	
-	// Calculate Data
-	DataSet_HDC2010H.Array_Statistic(Measurement_Array,Read_Count_,Average_Type_);
 
-	// Get Average
-	Value_ = DataSet_HDC2010H.Array_Average;
+}
+
+// Reading Functions
+void Environment::Set_Max_Age(const uint8_t Channel_, const uint32_t Max_Age_) {
+
+	// Set Channel Freshness Window
+	Cache.Set_Max_Age(Channel_, Max_Age_);
+
+}
+void Environment::Invalidate(const uint8_t Channel_) {
+
+	// Force Next Read to Measure
+	Cache.Invalidate(Channel_);
+
+}
+Environment_Reading Environment::Reading(const uint8_t Channel_) {
+
+	// Get Last Reading
+	return(Cache.Get(Channel_));
+
+}
+const Environment_Reading * Environment::Readings(void) {
+
+	// Get Last Reading of All Channels
+	return(Cache.Table());
+
+}
+
+// Adaptive Sampling Functions
+void Environment::Set_Adaptive(const uint8_t Channel_, const float Target_Error_, const uint8_t Min_Count_, const uint8_t Max_Count_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return;
+
+	// Set Channel Settings
+	Adaptive[Channel_] = {Target_Error_, Min_Count_, Max_Count_};
+
+}
 
-	// ************************************************************
-	// Control For Sensor Range
-	// ************************************************************
-	if (Value_ < HDC2010[0].Range_Min or Value_ > HDC2010[0].Range_Max) return(-106);
+// Resolution Functions
+bool Environment::Set_Resolution(const uint8_t Channel_, const uint8_t Resolution_) {
 
-	// ************************************************************
-	// Calibrate Data
-	// ************************************************************
+	// Control for Descriptor Channel
+	const Environment_Descriptor * Descriptor_ = Descriptor(Channel_);
+	if (Descriptor_ == NULL) return(false);
 
-	Value_ = (HDC2010_T_Calibrarion_a * Value_) + HDC2010_T_Calibrarion_b;
+	// Control for Channel Resolution
+	Environment_Resolution Step_;
+	if (!Environment_Acquisition::Resolution(Descriptor_, Resolution_, Step_)) return(false);
+
+	// Set Channel Resolution
+	Resolution[Channel_] = Resolution_;
 
 	// End Function
-	return(Value_);
-		
+	return(true);
+
 }
-float Environment::MPL3115A2_Pressure(void) {
+uint32_t Environment::Read_Time(const uint8_t Channel_, const uint8_t Read_Count_, const uint8_t Resolution_) {
 
-	/******************************************************************************
-	 *	Project		: MPL3115A2 Pressure Read Function
-	 *	Developer	: Mehmet Gunce Akkoyun (akkoyun@me.com)
-	 *	Revision	: 04.00.00
-	 *	Release		: 04.11.2020
-	 ******************************************************************************/
-
-	// Set Sensor Definations
-	struct Sensor_Settings {
-		int		Range_Min;
-		int		Range_Max;
-		
-	};
-	Sensor_Settings MPL3115A2[] {
-		
-		500,		// Sensor Range Minimum
-		11000,		// Sensor Range Maximum
-
-	};
-	
-	// Declare Output Variable
-	float Value_;
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return(0);
+
+	// Control for Descriptor Channel
+	const Environment_Descriptor * Descriptor_ = Descriptor(Channel_);
+	if (Descriptor_ == NULL) {
+
+		// Sum Conversion Waits of Channel Steps (fixed settings)
+		uint32_t Wait_ = 0;
+		for (uint8_t i = 0; i < ENV_ASYNC_STEP_COUNT; i++) if (pgm_read_byte(&ENV_ASYNC_STEP[i].Channel) == Channel_) Wait_ += pgm_read_word(&ENV_ASYNC_STEP[i].Wait);
+
+		// End Function (ms to uS)
+		return(Wait_ * 1000 * Read_Count_);
+
+	}
+
+	// Calculate Read Time (configured device skips reset)
+	return(Environment_Acquisition::Latency(Descriptor_, (Resolution_ == ENV_RESOLUTION_DEFAULT) ? Resolution[Channel_] : Resolution_, Read_Count_, Driver(Channel_Device(Channel_)).Is_Configured()));
+
+}
+
+// Deadline Functions
+float Environment::Read_Within(const uint8_t Channel_, const uint32_t Deadline_, float * Precision_, const uint8_t Average_Type_, const uint32_t Max_Age_) {
+
+	// Control for Descriptor Channel
+	const Environment_Descriptor * Descriptor_ = Descriptor(Channel_);
+	if (Descriptor_ == NULL) return(-100);
+
+	// Declare Plan Variables
+	uint8_t Resolution_ = ENV_RESOLUTION_DEFAULT;
+	uint8_t Read_Count_ = 0;
+
+	// Plan Acquisition Unless a Fresh Reading Exists (bus at clock of device transactions)
+	bool Fresh_ = Cache.Fresh(Channel_);
+	if (!Fresh_) Environment_Acquisition::Plan(Descriptor_, Deadline_, Noise(Channel_), Driver(Channel_Device(Channel_)).Is_Configured(), Driver(Channel_Device(Channel_)).Clock(), Resolution_, Read_Count_);
+
+	// Reuse Last Reading When Fresh or Nothing Fits
+	if (Read_Count_ == 0) {
+
+		// Get Last Reading
+		const Environment_Reading & Last_ = Cache.Get(Channel_);
+
+		// Control for Successful Reading Within Reuse Limit (overflow safe age)
+		if (Last_.Error != 0 or Last_.Count == 0 or (!Fresh_ and (uint32_t)(millis() - Last_.Time) > Max_Age_)) {
+
+			// Clear Precision
+			if (Precision_ != NULL) *Precision_ = 0;
+
+			// End Function
+			return(ENV_ERROR_DEADLINE);
 
-	// ************************************************************
-	// Controll For WHO_AM_I Register
-	// ************************************************************
-
-	// Request WHO_AM_I Register
-	Wire.beginTransmission(0b01100000);
-	Wire.write(0b00001100);
-
-	// Close I2C Connection
-	int MPL3115A2_Sensor_Identification = Wire.endTransmission(false);
-
-	// Control For Identifier Read Success
-	if (MPL3115A2_Sensor_Identification != 0) return(-101);
-
-	// Read Device Identifier Register
-	Wire.requestFrom(0b01100000, 1);
-
-	// Read WHO_AM_I Register
-	uint8_t MPL3115A2_Device_Signiture = Wire.read();
-
-	// ************************************************************
-	// Control for Sensor ID
-	// ************************************************************
-
-	// Control for Device Identifier
-	if (MPL3115A2_Device_Signiture == 0b11000100) {
-		
-		// ************************************************************
-		// Set CTRL_REG1 Register
-		// ************************************************************
-		
-		// Set CTRL_REG1 Register
-		Wire.beginTransmission(0b01100000);
-		Wire.write(0b00100110);
-		Wire.write(0b00111001);
-		
-		// Close I2C Connection
-		int MPL3115A2_Sensor_CTRL_REG1_Register = Wire.endTransmission(false);
-		
-		// Control For Register Write
-		if (MPL3115A2_Sensor_CTRL_REG1_Register != 0) return(-102);
-		
-		// ************************************************************
-		// Set PT_DATA_CFG Register
-		// ************************************************************
-		
-		// Set PT_DATA_CFG Register
-		Wire.beginTransmission(0b01100000);
-		Wire.write(0b00010011);
-		Wire.write(0b00000111);
-		
-		// Close I2C Connection
-		int MPL3115A2_Sensor_PT_DATA_CFG_Register = Wire.endTransmission(false);
-		
-		// Control For Register Write
-		if (MPL3115A2_Sensor_PT_DATA_CFG_Register != 0) return(-103);
-		
-		// ************************************************************
-		// Read Sensor Datas
-		// ************************************************************
-		
-		// Define Variables
-		uint8_t MPL3115A2_Read_Status = 0;
-		uint8_t Ready_Status_Try_Counter = 0;
-		
-		// ************************************************************
-		// Wait for Measurement Complate
-		// ************************************************************
-		while ((MPL3115A2_Read_Status & 0b00000100) != 0b00000100) {
-			
-			//  Request Pressure Ready Status
-			Wire.beginTransmission(0b01100000);
-			Wire.write(0b00000000);
-			
-			// Close I2C Connection
-			int MPL3115A2_Sensor_Pressure_Ready_Status = Wire.endTransmission(false);
-			
-			// Control For Ready Status Write
-			if (MPL3115A2_Sensor_Pressure_Ready_Status != 0) return(-105);
-			
-			// Read Device Status Register
-			Wire.requestFrom(0b01100000, 1);
-			MPL3115A2_Read_Status = Wire.read();
-			
-			// Increase Counter
-			Ready_Status_Try_Counter += 1;
-			
-			// Control for Wait Counter
-			if (Ready_Status_Try_Counter > 50) return(-106);
-
-			// Ready Status Wait Delay
-			if ((MPL3115A2_Read_Status & 0b00000100) != 0b00000100) delay(50);
-			
 		}
-		
-		// ************************************************************
-		// Read Sensor Data
-		// ************************************************************
-		
-		// Request Pressure Data
-		Wire.beginTransmission(0b01100000);
-		Wire.write(0b00000001);
-		
-		// Close I2C Connection
-		int MPL3115A2_Sensor_Data_Read = Wire.endTransmission(false);
-		
-		// Control For Read Command Success
-		if (MPL3115A2_Sensor_Data_Read != 0) return(-107);
-		
-		// Request Pressure Data
-		Wire.requestFrom(0b01100000,3);
-		
-		// Define Data Variable
-		uint8_t MPL3115A2_Data[3];
-		
-		// Read I2C Bytes
-		MPL3115A2_Data[0] = Wire.read();
-		MPL3115A2_Data[1] = Wire.read();
-		MPL3115A2_Data[2] = Wire.read();
-		
-		// ************************************************************
-		// Calculate Measurement Value
-		// ************************************************************
-		
-		// Define Variables
-		uint32_t Measurement_Raw = 0;
-		
-		// Combine Read Bytes
-		Measurement_Raw = MPL3115A2_Data[0];
-		Measurement_Raw <<= 8;
-		Measurement_Raw |= MPL3115A2_Data[1];
-		Measurement_Raw <<= 8;
-		Measurement_Raw |= MPL3115A2_Data[2];
-		Measurement_Raw >>= 4;
-		
-		// Calculate Pressure (mBar)
-		Value_ = (MPL3115A2_P_Calibrarion_a * ((Measurement_Raw / 4.00 ) / 100)) + MPL3115A2_P_Calibrarion_b;
-
-		// Read Delay
-		delay(512);
+
+		// Set Precision of Last Reading (channel resolution)
+		if (Precision_ != NULL) *Precision_ = Environment_Acquisition::Precision(Descriptor_, Resolution[Channel_], Last_.Count, Noise(Channel_));
+
+		// End Function
+		return(Last_.Value);
 
 	}
 
-	// ************************************************************
-	// Control For Sensor Range
-	// ************************************************************
-	if (Value_ <= MPL3115A2[0].Range_Min or Value_ >= MPL3115A2[0].Range_Max) return(-108);
+	// Measure Planned Acquisition (fixed sample count)
+	Summary_Reset();
+	float Value_ = -100;
+	switch (Channel_) {
+
+		case ENV_SHT21_TEMPERATURE:		Value_ = SHT21.Temperature(Read_Count_, Average_Type_, NULL, &Measurement, Resolution_); break;
+		case ENV_SHT21_HUMIDITY:		Value_ = SHT21.Humidity(Read_Count_, Average_Type_, NULL, &Measurement, Resolution_); break;
+		case ENV_HDC2010_TEMPERATURE:	Value_ = HDC2010.Temperature(Read_Count_, Average_Type_, NULL, &Measurement, Resolution_); break;
+		case ENV_HDC2010_HUMIDITY:		Value_ = HDC2010.Humidity(Read_Count_, Average_Type_, NULL, &Measurement, Resolution_); break;
+
+	}
+
+	// Store Reading
+	Value_ = Store(Channel_, Value_, Resolution_);
+
+	// Set Achieved Precision (valid samples only)
+	if (Precision_ != NULL) *Precision_ = (Measurement.Error == 0) ? Environment_Acquisition::Precision(Descriptor_, Resolution_, Measurement.Count, Noise(Channel_)) : 0;
 
 	// End Function
 	return(Value_);
 
 }
-float Environment::TSL2561_Light(void) {
-	
-	/******************************************************************************
-	 *	Project		: TSL2561 Light Read Function
-	 *	Developer	: Mehmet Gunce Akkoyun (akkoyun@me.com)
-	 *	Revision	: 04.00.00
-	 *	Release		: 04.11.2020
-	 ******************************************************************************/
-	
-	// Define Sensor Settings
-	int TSL2561_Integrate_Time 	= 1; // 13.7 ms - 0.034 Scale
-	int TSL2561_Gain 			= 1; // 1x Gain
-	
-	// Declare Output Variable
-	float Value_;
 
-	/****************************************
-	 * Read Device ID Register from TSL2561
-	 ****************************************/
-	
-	// Request Device ID Register
-	Wire.beginTransmission(0b00111001);
-	Wire.write(0b10001010); // 0x80 | 0x0A
-	
-	// Close I2C Connection
-	Wire.endTransmission();
-	
-	// Read Device ID Register
-	Wire.requestFrom(0b00111001, 1);
-	uint8_t TSL2561_Device_ID = Wire.read();
-	
-	// 0b0000xxxx = TSL2560
-	// 0b0001xxxx = TSL2561
-	
-	// Control for Device ID
-	if (TSL2561_Device_ID == 0b01010000 or TSL2561_Device_ID == 0b11111111) {
-		
-		/****************************************
-		 * Read Timing Register from TSL2561
-		 ****************************************/
-		
-		// Request Timing Register
-		Wire.beginTransmission(0b00111001);
-		Wire.write(0b10000001); // 0x80 | 0x01
-		
-		// Close I2C Connection
-		Wire.endTransmission(false);
-		
-		// Read Timing Register
-		Wire.requestFrom(0b00111001, 1);
-		uint8_t TSL2561_Timing_Register  = Wire.read();
-		
-		/****************************************
-		 * Set Timing & Gain bits
-		 ****************************************/
-		
-		// Set Integrate Time Bit Values
-		if (TSL2561_Integrate_Time == 1) {
-			
-			// Set Bit 0 LOW
-			TSL2561_Timing_Register &= 0b11111110;
-			
-			// Set Bit 1 LOW
-			TSL2561_Timing_Register &= 0b11111101;
-			
-		} // 0.034 Scale - 13.7 ms
-		if (TSL2561_Integrate_Time == 2) {
-			
-			// Set Bit 0 HIGH
-			TSL2561_Timing_Register |= 0b00000001;
-			
-			// Set Bit 1 LOW
-			TSL2561_Timing_Register &= 0b11111101;
-			
-		} // 0.252 Scale - 101 ms
-		if (TSL2561_Integrate_Time == 3) {
-			
-			// Set Bit 0 LOW
-			TSL2561_Timing_Register &= 0b11111110;
-			
-			// Set Bit 1 HIGH
-			TSL2561_Timing_Register |= 0b00000010;
-			
-		} // 1.000 Scale - 402 ms
-		
-		// Set Gain Bit Values
-		if (TSL2561_Gain == 0) {
-			
-			// Set Bit 4 LOW
-			TSL2561_Timing_Register &= 0b11101111;
-			
-		} // 0 - Low Gain (1x)
-		if (TSL2561_Gain == 1) {
-			
-			// Set Bit 4 HIGH
-			TSL2561_Timing_Register |= 0b00010000;
-			
-		} // 1 - High Gain (16x)
-		
-		/****************************************
-		 * Write Timing Register to TSL2561
-		 ****************************************/
-		
-		// Write Timing Register
-		Wire.beginTransmission(0b00111001);
-		Wire.write(0b10000001); // 0x80 | 0x01
-		Wire.write(TSL2561_Timing_Register);
-		
-		// Close I2C Connection
-		int TSL2561_Timing_Register_Write = Wire.endTransmission(false);
-		
-		// Control For Register Write
-		if (TSL2561_Timing_Register_Write != 0) return(-101);
-		
-		// Delay
-		delay(50);
-		
-		/****************************************
-		 * Power ON TSL2561
-		 ****************************************/
-		
-		// Set Power On Register
-		Wire.beginTransmission(0b00111001);
-		Wire.write(0b10000000); // 0x80 | 0x00
-		Wire.write(0b00000011); // 0x03
-		
-		// Close I2C Connection
-		int TSL2561_Power_ON_Register_Write = Wire.endTransmission(false);
-		
-		// Control For Register Write
-		if (TSL2561_Power_ON_Register_Write != 0) return(-102);
-		
-		/****************************************
-		 * Read CH0
-		 ****************************************/
-		
-		// Request DATA0LOW Register
-		Wire.beginTransmission(0b00111001);
-		Wire.write(0b10001100);
-		
-		// Close I2C Connection
-		Wire.endTransmission(false);
-		
-		// Read DATA0LOW Register
-		Wire.requestFrom(0b00111001, 1);
-		uint8_t TSL2561_CH0_LSB = Wire.read();
-		
-		// Request DATA0HIGH Register
-		Wire.beginTransmission(0b00111001);
-		Wire.write(0b10001101);
-		
-		// Close I2C Connection
-		Wire.endTransmission(false);
-		
-		// Read DATA0HIGH Register
-		Wire.requestFrom(0b00111001, 1);
-		uint8_t TSL2561_CH0_MSB = Wire.read();
-		
-		// Combine Read Bytes
-		uint16_t TSL2561_CH0 = (TSL2561_CH0_MSB << 8) | TSL2561_CH0_LSB;
-		
-		/****************************************
-		 * Read CH1
-		 ****************************************/
-		
-		// Request DATA1LOW Register
-		Wire.beginTransmission(0b00111001);
-		Wire.write(0b10001110);
-		
-		// Close I2C Connection
-		Wire.endTransmission(false);
-		
-		// Read DATA1LOW Register
-		Wire.requestFrom(0b00111001, 1);
-		uint8_t TSL2561_CH1_LSB = Wire.read();
-		
-		// Request DATA1HIGH Register
-		Wire.beginTransmission(0b00111001);
-		Wire.write(0b10001111);
-		
-		// Close I2C Connection
-		Wire.endTransmission(false);
-		
-		// Read DATA1HIGH Register
-		Wire.requestFrom(0b00111001, 1);
-		uint8_t TSL2561_CH1_MSB = Wire.read();
-		
-		// Combine Read Bytes
-		uint16_t TSL2561_CH1 = (TSL2561_CH1_MSB << 8) | TSL2561_CH1_LSB;
-		
-		/****************************************
-		 * Normalize Data
-		 ****************************************/
-		
-		unsigned long TSL2561_Channel_Scale; 	// chScale
-		unsigned long TSL2561_Channel_1;		// channel1
-		unsigned long TSL2561_Channel_0;		// channel0
-		
-		// Scale for Integration Time
-		switch (TSL2561_Integrate_Time) {
-				
-			case 1:
-				
-				TSL2561_Channel_Scale = 0x7517;
-				break;
-				
-			case 2:
-				
-				TSL2561_Channel_Scale = 0x0FE7;
-				break;
-				
-			case 3:
-				
-				TSL2561_Channel_Scale = (1 << 10);
-				break;
-				
-			default:
-				break;
-		}
-		
-		// Scale for Gain
-		if (TSL2561_Gain == 1) TSL2561_Channel_Scale = TSL2561_Channel_Scale;
-		if (TSL2561_Gain == 2) TSL2561_Channel_Scale = TSL2561_Channel_Scale << 4;
-		
-		// Scale Channel Values
-		TSL2561_Channel_0 = (TSL2561_CH0 * TSL2561_Channel_Scale) >> 10;
-		TSL2561_Channel_1 = (TSL2561_CH1 * TSL2561_Channel_Scale) >> 10;
-		
-		/****************************************
-		 * Calculate LUX
-		 ****************************************/
-		
-		// Find the Ratio of the Channel Values (Channel1/Channel0)
-		unsigned long TSL2561_Channel_Ratio = 0;
-		if (TSL2561_Channel_0 != 0) TSL2561_Channel_Ratio = (TSL2561_Channel_1 << 10) / TSL2561_Channel_0;
-		
-		// Round the Ratio Value
-		unsigned long TSL2561_Ratio = (TSL2561_Channel_Ratio + 1) >> 1;
-		
-		unsigned int TSL2561_Calculation_B, TSL2561_Calculation_M;
-		
-		if ((TSL2561_Ratio >= 0) && (TSL2561_Ratio <= 0x0040)) {
-			
-			TSL2561_Calculation_B = 0x01F2;
-			TSL2561_Calculation_M = 0x01BE;
-			
-		}
-		else if (TSL2561_Ratio <= 0x0080) {
-			
-			TSL2561_Calculation_B = 0x0214;
-			TSL2561_Calculation_M = 0x02D1;
-			
-		}
-		else if (TSL2561_Ratio <= 0x00C0) {
-			
-			TSL2561_Calculation_B = 0x023F;
-			TSL2561_Calculation_M = 0x037B;
-			
-		}
-		else if (TSL2561_Ratio <= 0x0100) {
-			
-			TSL2561_Calculation_B = 0x0270;
-			TSL2561_Calculation_M = 0x03FE;
-			
-		}
-		else if (TSL2561_Ratio <= 0x0138) {
-			
-			TSL2561_Calculation_B = 0x016F;
-			TSL2561_Calculation_M = 0x01FC;
-			
-		}
-		else if (TSL2561_Ratio <= 0x019A) {
-			
-			TSL2561_Calculation_B = 0x00D2;
-			TSL2561_Calculation_M = 0x00FB;
-			
-		}
-		else if (TSL2561_Ratio <= 0x029A) {
-			
-			TSL2561_Calculation_B = 0x0018;
-			TSL2561_Calculation_M = 0x0012;
-			
-		}
-		else if (TSL2561_Ratio > 0x029A) {
-			
-			TSL2561_Calculation_B = 0x0000;
-			TSL2561_Calculation_M = 0x0000;
-			
-		}
-		
-		unsigned long TSL2561_Lux_Temp;
-		
-		// Calculate Temp Lux Value
-		TSL2561_Lux_Temp = ((TSL2561_Channel_0 * TSL2561_Calculation_B) - (TSL2561_Channel_1 * TSL2561_Calculation_M));
-		
-		// Do not Allow Negative Lux Value
-		if (TSL2561_Lux_Temp < 0) TSL2561_Lux_Temp = 0;
-		
-		// Round LSB (2^(LUX_SCALE-1))
-		TSL2561_Lux_Temp += (1 << 13);
-		
-		// Strip Fff Fractional Portion
-		Value_ = TSL2561_Lux_Temp >> 14;
-		
-		/****************************************
-		 * Read Delay
-		 ****************************************/
-		
-		// Delay
-		if (TSL2561_Integrate_Time == 1) delay(14);
-		if (TSL2561_Integrate_Time == 2) delay(102);
-		if (TSL2561_Integrate_Time == 3) delay(403);
-		
-		/****************************************
-		 * Power OFF TSL2561
-		 ****************************************/
-		
-		// Set Power Off Register
-		Wire.beginTransmission(0b00111001);
-		Wire.write(0b10000000); // 0x80 | 0x00
-		Wire.write(0b00000000); // 0x00
-		
-		// Close I2C Connection
-		int TSL2561_Power_OFF_Register_Write = Wire.endTransmission(false);
-		
-		// Control For Register Write
-		if (TSL2561_Power_OFF_Register_Write != 0) return(-103);
-		
-		// Power Off Delay
-		delay(50);
+// Partial Result Functions
+void Environment::Set_Partial(const uint8_t Device_, const bool Enable_, const uint8_t Retry_) {
+
+	// Control for Device
+	if (Device_ >= ENV_DEVICE_COUNT) return;
+
+	// Set Driver Mode
+	Driver(Device_).Set_Partial(Enable_, Retry_);
+
+}
+// Filter Functions
+void Environment::Set_EMA(const uint8_t Channel_, const float Alpha_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return;
+
+	// Set Filter
+	Filter[Channel_].Set_EMA(Alpha_);
+
+}
+void Environment::Set_Kalman(const uint8_t Channel_, const float Process_Noise_, const float Measurement_Noise_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return;
+
+	// Default Measurement Noise From Sensor Repeatability
+	float R_ = (Measurement_Noise_ > 0) ? Measurement_Noise_ : Noise(Channel_) * Noise(Channel_);
+
+	// Default Process Noise (slow drift, 1 % of measurement noise per call)
+	float Q_ = (Process_Noise_ > 0) ? Process_Noise_ : R_ / 100;
+
+	// Set Filter
+	Filter[Channel_].Set_Kalman(Q_, R_);
+
+}
+void Environment::Disable_Filter(const uint8_t Channel_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return;
+
+	// Disable Filter
+	Filter[Channel_].Disable();
+
+}
+void Environment::Reset_Filter(const uint8_t Channel_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return;
+
+	// Restart Filter on Next Reading
+	Filter[Channel_].Reset();
+
+}
+
+// Change Reporting Functions
+void Environment::Set_Deadband(const uint8_t Channel_, const float Absolute_, const float Relative_, const float Hysteresis_, const uint32_t Heartbeat_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return;
+
+	// Set Detector
+	Deadband[Channel_].Set(Absolute_, Relative_, Hysteresis_, Heartbeat_);
+
+}
+bool Environment::Report(const uint8_t Channel_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return(false);
+
+	// Check Last Reading
+	return(Deadband[Channel_].Check(Cache.Get(Channel_)));
+
+}
+
+// Rollup Functions
+void Environment::Attach(Environment_Rollup & Rollup_) {
+
+	// Control for Attached Rollup
+	for (Environment_Rollup * Rollup_Item_ = Rollup_Head; Rollup_Item_ != NULL; Rollup_Item_ = Rollup_Item_->Next) if (Rollup_Item_ == &Rollup_) return;
+
+	// Add to List Head
+	Rollup_.Next = Rollup_Head;
+	Rollup_Head = &Rollup_;
+
+}
+void Environment::Detach(Environment_Rollup & Rollup_) {
+
+	// Find Rollup Link
+	for (Environment_Rollup ** Link_ = &Rollup_Head; *Link_ != NULL; Link_ = &(*Link_)->Next) {
+
+		// Control for Rollup
+		if (*Link_ != &Rollup_) continue;
+
+		// Unlink Rollup
+		*Link_ = Rollup_.Next;
+		Rollup_.Next = NULL;
 
-	}
-	else {
-		
 		// End Function
-		return(-104);
-		
+		return;
+
+	}
+
+}
+
+// Statistic Functions
+void Environment::Summary_Reset(void) {
+
+	// Clear Sample Statistics
+	Measurement.Count = 0;
+	Measurement.Failed = 0;
+
+}
+float Environment::Store(const uint8_t Channel_, const float Value_, const uint8_t Resolution_) {
+
+	// Set Reading
+	Measurement.Value = Value_;
+	Measurement.Time = millis();
+	Measurement.Error = (Value_ <= ENV_ERROR_LIMIT) ? (int16_t)Value_ : 0;
+
+	// Filter Successful Readings (errors leave filter state untouched, Kalman R follows sample count and resolution)
+	if (Measurement.Error == 0 and Filter[Channel_].Type() != ENV_FILTER_NONE) Measurement.Value = Filter[Channel_].Update(Value_, Measurement.Count, Quantization(Channel_, Resolution_));
+
+	// Single Sample Statistics
+	if (Measurement.Count == 0) {
+
+		// Set Statistics
+		Measurement.Min = Value_;
+		Measurement.Max = Value_;
+		Measurement.Deviation = 0;
+		Measurement.Count = (Measurement.Error == 0) ? 1 : 0;
+
 	}
-	
+
+	// Store Reading
+	Cache.Store(Channel_, Measurement);
+
+	// Feed Rollups With Successful Readings
+	if (Measurement.Error == 0) for (Environment_Rollup * Rollup_ = Rollup_Head; Rollup_ != NULL; Rollup_ = Rollup_->Next) if (Rollup_->Window_Channel == Channel_) Rollup_->Add(Measurement.Value, Measurement.Time);
+
 	// End Function
-	return(Value_);
-	
+	return(Measurement.Value);
+
+}
+
+// Driver Functions
+Environment_Driver & Environment::Driver(const uint8_t Device_) {
+
+	// Map Device to Driver
+	switch (Device_) {
+
+		case ENV_HDC2010:	return(HDC2010);
+		case ENV_MPL3115A2:	return(MPL3115A2);
+		case ENV_TSL2561:	return(TSL2561);
+		default:			return(SHT21);
+
+	}
+
+}
+float Environment::Noise(const uint8_t Channel_) {
+
+	// Channel Repeatability
+	static const float Noise_[ENV_CHANNEL_COUNT] = {ENV_SHT21_T_NOISE, ENV_SHT21_H_NOISE, ENV_HDC2010_T_NOISE, ENV_HDC2010_H_NOISE, ENV_MPL3115A2_P_NOISE, ENV_TSL2561_L_NOISE};
+
+	// End Function
+	return((Channel_ < ENV_CHANNEL_COUNT) ? Noise_[Channel_] : 0);
+
+}
+float Environment::Quantization(const uint8_t Channel_, const uint8_t Resolution_) {
+
+	// Control for Descriptor Channel
+	const Environment_Descriptor * Descriptor_ = Descriptor(Channel_);
+	if (Descriptor_ == NULL) return(0);
+
+	// Resolution Step Variance (precision of a noiseless single sample)
+	float Step_ = Environment_Acquisition::Precision(Descriptor_, Resolution_, 1, 0);
+
+	// End Function
+	return(Step_ * Step_);
+
 }
+const Environment_Descriptor * Environment::Descriptor(const uint8_t Channel_) {
 
-Environment Sensor;
+	// Map Channel to Descriptor (SHT21 and HDC2010 channels)
+	switch (Channel_) {
 
-// 1903
+		case ENV_SHT21_TEMPERATURE:		return(&ENV_SHT21_T_DESCRIPTOR);
+		case ENV_SHT21_HUMIDITY:		return(&ENV_SHT21_H_DESCRIPTOR);
+		case ENV_HDC2010_TEMPERATURE:	return(&ENV_HDC2010_T_DESCRIPTOR);
+		case ENV_HDC2010_HUMIDITY:		return(&ENV_HDC2010_H_DESCRIPTOR);
+		default:						return(NULL);
+
+	}
+
+}
@@ -13,17 +13,54 @@
 #ifndef __Environment__
 #define __Environment__
 
-// Define Arduino Library
-#ifndef __Arduino__
-#include <Arduino.h>
-#endif
+// Define Platform Layer
+#include "Environment_Platform.h"
 
-// Define Wire Library
-#ifndef __Wire__
-#include <Wire.h>
-#endif
+// Define Bus Layer
+#include "Environment_Bus.h"
 
-#include <Statistical.h>
+// Define Sensor Drivers
+#include "Environment_SHT21.h"
+#include "Environment_HDC2010.h"
+#include "Environment_MPL3115A2.h"
+#include "Environment_TSL2561.h"
+
+// Define Asynchronous Queue
+#include "Environment_Async.h"
+
+// Define Reading Cache
+#include "Environment_Cache.h"
+
+// Define Adaptive Sampling
+#include "Environment_Adaptive.h"
+
+// Define Recursive Filter
+#include "Environment_Filter.h"
+
+// Define Change Detector
+#include "Environment_Deadband.h"
+
+// Define Windowed Rollups
+#include "Environment_Rollup.h"
+
+// ************************************************************
+// Device Definations
+// ************************************************************
+
+// Device ID
+#define ENV_SHT21					0
+#define ENV_HDC2010					1
+#define ENV_MPL3115A2				2
+#define ENV_TSL2561					3
+#define ENV_DEVICE_COUNT			4
+
+// Channel Measurement Noise (1 sigma repeatability, channel units)
+#define ENV_SHT21_T_NOISE			0.04	// C, 14 bit
+#define ENV_SHT21_H_NOISE			0.04	// %RH, 12 bit
+#define ENV_HDC2010_T_NOISE			0.1		// C
+#define ENV_HDC2010_H_NOISE			0.1		// %RH
+#define ENV_MPL3115A2_P_NOISE		0.015	// hPa
+#define ENV_TSL2561_L_NOISE			1.0		// Lux
 
 class Environment
 {
@@ -33,9 +70,26 @@ public:
 	// Public Functions
 	// ************************************************************
 
+	// Constructor
+	Environment(Environment_Bus & Bus_ = Environment_I2C, Environment_Async & Queue_ = Environment_Queue);
+
+	// Device Configuration
+	void Set_Address(const uint8_t Device_, const uint8_t Address_);
+	void Set_Mux(const uint8_t Device_, const uint8_t Mux_Address_, const uint8_t Mux_Channel_);
+	void Set_Max_Clock(const uint8_t Device_, const uint32_t Max_Clock_);
+
+	// Warm Start (bit per started device, configured devices skip reset on every read)
+	uint8_t Begin(void);
+	uint8_t Start_State(const uint8_t Device_);
+	uint32_t First_Reading_Time(const uint8_t Device_);
+
+	// Bus Health (failed transactions of device)
+	uint16_t Failures(const uint8_t Device_);
+
 	// SHT21
 	float SHT21_Temperature(const uint8_t Read_Count_, const uint8_t Average_Type_);
 	float SHT21_Humidity(const uint8_t Read_Count_, const uint8_t Average_Type_);
+	bool SHT21_Read(float & Temperature_, float & Humidity_, float * Compensated_ = NULL);
 
 	// HDC2010
 	float HDC2010_Temperature(const uint8_t Read_Count_, const uint8_t Average_Type_);
@@ -47,31 +101,110 @@ public:
 	// TSL2561
 	float TSL2561_Light(void);
 
+	// Reading Cache
+	void Set_Max_Age(const uint8_t Channel_, const uint32_t Max_Age_);
+	void Invalidate(const uint8_t Channel_);
+	Environment_Reading Reading(const uint8_t Channel_);
+	const Environment_Reading * Readings(void);
+
+	// Adaptive Sampling (SHT21 and HDC2010 channels)
+	void Set_Adaptive(const uint8_t Channel_, const float Target_Error_, const uint8_t Min_Count_ = 2, const uint8_t Max_Count_ = 0);
+
+	// Resolution (SHT21 and HDC2010 channels, bits from the channel table, read time in uS without bus transfers, conversion waits of other channels)
+	bool Set_Resolution(const uint8_t Channel_, const uint8_t Resolution_);
+	uint32_t Read_Time(const uint8_t Channel_, const uint8_t Read_Count_ = 1, const uint8_t Resolution_ = ENV_RESOLUTION_DEFAULT);
+
+	// Deadline Read (SHT21 and HDC2010 channels, best resolution and sample count within Deadline_ uS, Precision_ is the expected standard error)
+	float Read_Within(const uint8_t Channel_, const uint32_t Deadline_, float * Precision_ = NULL, const uint8_t Average_Type_ = 1, const uint32_t Max_Age_ = ENV_DEADLINE_MAX_AGE);
+
+	// Partial Result Mode (SHT21 and HDC2010, failed samples are retried then dropped)
+	void Set_Partial(const uint8_t Device_, const bool Enable_, const uint8_t Retry_ = ENV_SAMPLE_RETRY);
+
+	// Generic Channel Read
+	float Read(const uint8_t Channel_, const uint8_t Read_Count_ = 1, const uint8_t Average_Type_ = 1);
+	static uint8_t Channel_Device(const uint8_t Channel_);
+
+	// Power Management
+	uint8_t Power_Down(const uint8_t Device_);
+
+	// Asynchronous Read (single sample, result through Reading() or callback, Force_ converts even when cache is fresh)
+	bool Start(const uint8_t Channel_, const bool Force_ = false);
+	bool Ready(const uint8_t Channel_);
+	void Poll(void);
+	void Set_Callback(void (*Callback_)(const uint8_t Channel_, const float Value_));
+
+	// Recursive Filter (kept across calls)
+	void Set_EMA(const uint8_t Channel_, const float Alpha_);
+	void Set_Kalman(const uint8_t Channel_, const float Process_Noise_ = 0, const float Measurement_Noise_ = 0);	// R is the single sample variance, scaled to sample count and resolution of each reading
+	void Disable_Filter(const uint8_t Channel_);
+	void Reset_Filter(const uint8_t Channel_);
+
+	// Change Reporting (true when the last reading is worth sending)
+	void Set_Deadband(const uint8_t Channel_, const float Absolute_, const float Relative_ = 0, const float Hysteresis_ = 0, const uint32_t Heartbeat_ = 0);
+	bool Report(const uint8_t Channel_);
+
+	// Windowed Rollups (fed by every successful reading of their channel)
+	void Attach(Environment_Rollup & Rollup_);
+	void Detach(Environment_Rollup & Rollup_);
+
 private:
 
 	// ************************************************************
-	// Calibration Constants
+	// Device Variables
 	// ************************************************************
 
-	// SHT21 Temperature
-	const float SHT21_T_Calibrarion_a = 1.0129; // MGM
-	const float SHT21_T_Calibrarion_b = 0.6075; // MGM
+	// Sensor Drivers
+	Environment_SHT21 SHT21;
+	Environment_HDC2010 HDC2010;
+	Environment_MPL3115A2 MPL3115A2;
+	Environment_TSL2561 TSL2561;
 
-	// SHT21 Humidity
-	const float SHT21_H_Calibrarion_a = 0.9518; // MGM
-	const float SHT21_H_Calibrarion_b = 3.5316; // MGM
+	// Reading Variables
+	Environment_Cache Cache;
+	Environment_Reading Measurement;
 
-	// MPL3115A2 Pressure
-	const float MPL3115A2_P_Calibrarion_a = 1;
-	const float MPL3115A2_P_Calibrarion_b = 0;
+	// Adaptive Sampling Settings
+	Environment_Adaptive Adaptive[ENV_CHANNEL_COUNT];
 
-	// HDC2010 Temperature
-	const float HDC2010_T_Calibrarion_a = 1.0053;
-	const float HDC2010_T_Calibrarion_b = -0.4102;
-	
-	// HDC2010 Humidity
-	const float HDC2010_H_Calibrarion_a = 0.9821;
-	const float HDC2010_H_Calibrarion_b = -0.3217;
+	// Channel Resolution Bits
+	uint8_t Resolution[ENV_CHANNEL_COUNT];
+
+	// Recursive Filters
+	Environment_Filter Filter[ENV_CHANNEL_COUNT];
+
+	// Change Detectors
+	Environment_Deadband Deadband[ENV_CHANNEL_COUNT];
+
+	// Attached Rollups
+	Environment_Rollup * Rollup_Head;
+
+	// Asynchronous Read Variables (one job per device)
+	Environment_Async * Queue;
+	Environment_Transaction Job[ENV_DEVICE_COUNT];
+	uint8_t Job_Channel[ENV_DEVICE_COUNT];
+	uint8_t Job_Step[ENV_DEVICE_COUNT];
+	uint8_t Job_Data[ENV_DEVICE_COUNT][4];
+	uint8_t Async_Pending;
+	void (*Async_Callback)(const uint8_t Channel_, const float Value_);
+
+	// ************************************************************
+	// Private Functions
+	// ************************************************************
+
+	// Driver Functions
+	Environment_Driver & Driver(const uint8_t Device_);
+	static const Environment_Descriptor * Descriptor(const uint8_t Channel_);
+	static float Noise(const uint8_t Channel_);
+
+	// Asynchronous Read Functions
+	bool Async_Submit(const uint8_t Device_);
+	float Async_Value(const uint8_t Device_);
+	static void Async_Complete(Environment_Transaction * Transaction_);
+
+	// Statistic Functions
+	void Summary_Reset(void);
+	float Store(const uint8_t Channel_, const float Value_, const uint8_t Resolution_ = ENV_RESOLUTION_DEFAULT);
+	static float Quantization(const uint8_t Channel_, const uint8_t Resolution_);
 
 };
 
@@ -0,0 +1,61 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Adaptive Sampling.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Adaptive.h"
+
+Environment_Estimator::Environment_Estimator(const Environment_Adaptive & Settings_, const float Calibration_a_) {
+
+	// Convert Target to Raw Units (squared, no sqrt in loop)
+	float Target_ = Settings_.Target_Error / fabs(Calibration_a_);
+	Target_Variance = (Settings_.Target_Error > 0) ? Target_ * Target_ : -1;
+
+	// Variance Needs at Least 2 Samples
+	Min_Count = (Settings_.Min_Count < 2) ? 2 : Settings_.Min_Count;
+
+	// Clear Estimate
+	Count = 0;
+	Average = 0;
+	M2 = 0;
+
+}
+
+// Estimator Functions
+bool Environment_Estimator::Converged(const float Sample_) {
+
+	// Update Running Mean and Squared Deviation
+	Count++;
+	float Delta_ = Sample_ - Average;
+	Average += Delta_ / Count;
+	M2 += Delta_ * (Sample_ - Average);
+
+	// Control for Adaptive Mode and Minimum Count
+	if (Target_Variance < 0 or Count < Min_Count) return(false);
+
+	// SE^2 = s^2 / n = M2 / ((n - 1) * n)
+	return(M2 <= Target_Variance * (float)(Count - 1) * (float)Count);
+
+}
+float Environment_Estimator::Mean(void) {
+
+	// End Function
+	return(Average);
+
+}
+float Environment_Estimator::Standard_Error(void) {
+
+	// Control for Count
+	if (Count < 2) return(0);
+
+	// End Function
+	return(sqrt(M2 / ((float)(Count - 1) * (float)Count)));
+
+}
@@ -0,0 +1,63 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Adaptive Sampling.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Adaptive__
+#define __Environment_Adaptive__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// Confidence Interval to Standard Error (95 % two sided, normal)
+#define ENV_CI95_TO_SE(Half_Width_)	((Half_Width_) / 1.96)
+
+// Adaptive Sampling Settings
+struct Environment_Adaptive {
+
+	float		Target_Error;	// Target standard error of mean (0 disables)
+	uint8_t		Min_Count;		// Minimum sample count (at least 2)
+	uint8_t		Max_Count;		// Maximum sample count (0 uses Read_Count_)
+
+};
+
+// Sequential Mean Estimator (Welford)
+class Environment_Estimator
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Estimator(const Environment_Adaptive & Settings_, const float Calibration_a_ = 1);
+
+	// Add Sample, Returns True When Target Error is Reached
+	bool Converged(const float Sample_);
+
+	// Estimate
+	float Mean(void);
+	float Standard_Error(void);
+
+private:
+
+	// ************************************************************
+	// Estimator Variables
+	// ************************************************************
+
+	float Target_Variance;
+	uint8_t Min_Count;
+	uint8_t Count;
+	float Average;
+	float M2;
+
+};
+
+#endif /* defined(__Environment_Adaptive__) */
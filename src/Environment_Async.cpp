@@ -0,0 +1,195 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Asynchronous Transaction Queue.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Async.h"
+
+Environment_Async::Environment_Async(Environment_Bus & Bus_) {
+
+	// Set I2C Bus
+	Bus = &Bus_;
+
+	// Empty Queue
+	Head = NULL;
+	Tail = NULL;
+
+}
+
+// Queue Functions
+bool Environment_Async::Submit(Environment_Transaction & Transaction_) {
+
+	// Control for Busy Descriptor
+	if (Transaction_.Status == ENV_ASYNC_QUEUED or Transaction_.Status == ENV_ASYNC_WAIT) return(false);
+
+	// Control for Command Length
+	if (Transaction_.Command_Length > ENV_ASYNC_COMMAND_SIZE) return(false);
+
+	// One Transaction in Flight per Device (conversions must not overlap)
+	for (Environment_Transaction * i = Head; i != NULL; i = i->Next) if (i->Device == Transaction_.Device) return(false);
+
+	// Set State
+	Transaction_.Status = ENV_ASYNC_QUEUED;
+	Transaction_.Result = ENV_BUS_OK;
+	Transaction_.Next = NULL;
+
+	// Append to Queue
+	if (Tail == NULL) Head = &Transaction_; else Tail->Next = &Transaction_;
+	Tail = &Transaction_;
+
+	// End Function
+	return(true);
+
+}
+void Environment_Async::Poll(void) {
+
+	// Declare Variables
+	Environment_Transaction * Previous_ = NULL;
+	Environment_Transaction * Transaction_ = Head;
+
+	// Walk Queue (every device converts in parallel, bus is used only for short phases)
+	while (Transaction_ != NULL) {
+
+		// Keep Next Descriptor (completion unlinks current one)
+		Environment_Transaction * Next_ = Transaction_->Next;
+
+		// Command Phase
+		if (Transaction_->Status == ENV_ASYNC_QUEUED) {
+
+			// Send Command
+			Transaction_->Result = Command(Transaction_);
+
+			// Control for Command Success
+			if (Transaction_->Result != ENV_BUS_OK) {
+
+				// Complete With Error
+				Complete(Transaction_, Previous_);
+
+				// Next Descriptor
+				Transaction_ = Next_;
+				continue;
+
+			}
+
+			// Start Conversion Wait
+			Transaction_->Status = ENV_ASYNC_WAIT;
+			Transaction_->Due = millis() + Transaction_->Wait;
+
+		}
+
+		// Read Phase
+		if (Transaction_->Status == ENV_ASYNC_WAIT and (int32_t)(millis() - Transaction_->Due) >= 0) {
+
+			// Read Data
+			Transaction_->Result = Read(Transaction_);
+
+			// Device Still Converting (NACK), Try Again Later
+			if (Transaction_->Result != ENV_BUS_OK and Transaction_->Retry > 0) {
+
+				// Set Retry
+				Transaction_->Retry--;
+				Transaction_->Due = millis() + ENV_ASYNC_RETRY_DELAY;
+
+			} else {
+
+				// Complete Transaction
+				Complete(Transaction_, Previous_);
+
+				// Next Descriptor
+				Transaction_ = Next_;
+				continue;
+
+			}
+
+		}
+
+		// Next Descriptor
+		Previous_ = Transaction_;
+		Transaction_ = Next_;
+
+	}
+
+}
+uint8_t Environment_Async::Pending(void) {
+
+	// Declare Variable
+	uint8_t Count_ = 0;
+
+	// Count Transactions
+	for (Environment_Transaction * i = Head; i != NULL; i = i->Next) Count_++;
+
+	// End Function
+	return(Count_);
+
+}
+uint32_t Environment_Async::Next_Due(void) {
+
+	// Declare Variables
+	uint32_t Wait_ = 0xFFFFFFFF;
+	uint32_t Now_ = millis();
+
+	// Find Nearest Phase
+	for (Environment_Transaction * i = Head; i != NULL; i = i->Next) {
+
+		// Control for Ready Phase
+		if (i->Status == ENV_ASYNC_QUEUED or (int32_t)(Now_ - i->Due) >= 0) return(0);
+
+		// Set Nearest
+		if (i->Due - Now_ < Wait_) Wait_ = i->Due - Now_;
+
+	}
+
+	// End Function
+	return(Wait_);
+
+}
+
+// Private Functions
+uint8_t Environment_Async::Command(Environment_Transaction * Transaction_) {
+
+	// Control for Command Phase
+	if (Transaction_->Command_Length == 0) return(ENV_BUS_OK);
+
+	// Start Bus Session
+	Environment_Bus_Session Session_(*Bus, *Transaction_->Device);
+
+	// Send Command
+	return(Bus->Write(*Transaction_->Device, Transaction_->Command, Transaction_->Command_Length));
+
+}
+uint8_t Environment_Async::Read(Environment_Transaction * Transaction_) {
+
+	// Control for Read Phase
+	if (Transaction_->Length == 0) return(ENV_BUS_OK);
+
+	// Start Bus Session
+	Environment_Bus_Session Session_(*Bus, *Transaction_->Device);
+
+	// Read Data
+	if (Transaction_->Register == ENV_ASYNC_NO_REGISTER) return(Bus->Read(*Transaction_->Device, Transaction_->Data, Transaction_->Length));
+
+	// Read Register
+	return(Bus->Read_Register(*Transaction_->Device, Transaction_->Register, Transaction_->Data, Transaction_->Length));
+
+}
+void Environment_Async::Complete(Environment_Transaction * Transaction_, Environment_Transaction * Previous_) {
+
+	// Unlink Descriptor
+	if (Previous_ == NULL) Head = Transaction_->Next; else Previous_->Next = Transaction_->Next;
+	if (Tail == Transaction_) Tail = Previous_;
+	Transaction_->Next = NULL;
+
+	// Set Status
+	Transaction_->Status = (Transaction_->Result == ENV_BUS_OK) ? ENV_ASYNC_DONE : ENV_ASYNC_ERROR;
+
+	// Call Completion (may submit the next transaction)
+	if (Transaction_->Callback != NULL) Transaction_->Callback(Transaction_);
+
+}
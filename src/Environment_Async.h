@@ -0,0 +1,101 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Asynchronous Transaction Queue.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Async__
+#define __Environment_Async__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// Define Bus Library
+#include "Environment_Bus.h"
+
+// ************************************************************
+// Queue Definations
+// ************************************************************
+
+// Transaction Status
+#define ENV_ASYNC_IDLE				0		// Descriptor is free
+#define ENV_ASYNC_QUEUED			1		// Waiting for its command phase
+#define ENV_ASYNC_WAIT				2		// Command sent, waiting for conversion
+#define ENV_ASYNC_DONE				3		// Read phase done
+#define ENV_ASYNC_ERROR				4		// Bus error, see Result
+
+// Transaction Settings
+#define ENV_ASYNC_COMMAND_SIZE		3		// Maximum command phase length (bytes)
+#define ENV_ASYNC_NO_REGISTER		0xFF	// Read phase without register pointer write
+#define ENV_ASYNC_RETRY_DELAY		5		// Delay between read retries (ms)
+
+// Transaction Descriptor (owned by the caller, linked into the queue while busy)
+struct Environment_Transaction {
+
+	// Request
+	const Environment_Device *	Device;								// Target device
+	uint8_t						Command[ENV_ASYNC_COMMAND_SIZE];	// Command phase bytes
+	uint8_t						Command_Length;						// Command phase length (0 = none)
+	uint16_t					Wait;								// Conversion time between phases (ms)
+	uint8_t						Register;							// Read register or ENV_ASYNC_NO_REGISTER
+	uint8_t *					Data;								// Read buffer
+	uint8_t						Length;								// Read length (0 = none)
+	uint8_t						Retry;								// Read retries on NACK (SHT21 no hold master)
+
+	// Completion
+	void						(*Callback)(Environment_Transaction * Transaction_);
+	void *						Context;
+
+	// State
+	volatile uint8_t			Status;
+	uint8_t						Result;
+	uint32_t					Due;
+	Environment_Transaction *	Next;
+
+};
+
+class Environment_Async
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Async(Environment_Bus & Bus_);
+
+	// Queue Functions
+	bool Submit(Environment_Transaction & Transaction_);
+	void Poll(void);
+	uint8_t Pending(void);
+	uint32_t Next_Due(void);
+
+private:
+
+	// ************************************************************
+	// Queue Variables
+	// ************************************************************
+
+	// I2C Bus
+	Environment_Bus * Bus;
+
+	// Transaction List
+	Environment_Transaction * Head;
+	Environment_Transaction * Tail;
+
+	// Transaction Phases
+	uint8_t Command(Environment_Transaction * Transaction_);
+	uint8_t Read(Environment_Transaction * Transaction_);
+	void Complete(Environment_Transaction * Transaction_, Environment_Transaction * Previous_);
+
+};
+
+extern Environment_Async Environment_Queue;
+
+#endif /* defined(__Environment_Async__) */
@@ -0,0 +1,492 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Batch Conversion.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Batch.h"
+
+#if defined(ENV_PLATFORM_LINUX)
+
+// Define Sensor Drivers (TSL2561 lux formula, MPL3115A2 calibration)
+#include "Environment_TSL2561.h"
+#include "Environment_MPL3115A2.h"
+
+// Vector Kernels (x86, selected at run time, no build flags needed)
+#if defined(__x86_64__) || defined(__i386__)
+#define ENV_BATCH_X86
+#include <immintrin.h>
+#endif
+
+// Device Rounding (separate multiply and add like the AVR float library)
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+// MPL3115A2 Raw Pressure Code (20 bit) and Valid Range (driver settings, mBar)
+#define ENV_BATCH_PRESSURE_MASK		0x000FFFFF
+#define ENV_BATCH_PRESSURE_MIN		500
+#define ENV_BATCH_PRESSURE_MAX		11000
+
+// TSL2561 Lux Ladder (ratio limit, B and M of the driver, zero above the last limit)
+#define ENV_BATCH_LADDER_COUNT		7
+static const uint32_t ENV_BATCH_LADDER_RATIO[ENV_BATCH_LADDER_COUNT] = {0x0040, 0x0080, 0x00C0, 0x0100, 0x0138, 0x019A, 0x029A};
+static const uint32_t ENV_BATCH_LADDER_B[ENV_BATCH_LADDER_COUNT] = {0x01F2, 0x0214, 0x023F, 0x0270, 0x016F, 0x00D2, 0x0018};
+static const uint32_t ENV_BATCH_LADDER_M[ENV_BATCH_LADDER_COUNT] = {0x01BE, 0x02D1, 0x037B, 0x03FE, 0x01FC, 0x00FB, 0x0012};
+
+// Kernel in Use
+uint8_t Environment_Batch::Active = 0xFF;
+
+// ************************************************************
+// Scalar Kernels (reference and array tails)
+// ************************************************************
+
+static void Convert_Scalar(const Environment_Descriptor & Descriptor_, const uint16_t * Raw_, float * Value_, size_t i, const size_t Count_) {
+
+	// Convert Codes
+	for (; i < Count_; i++) {
+
+		// Calculate Measurement (status bits cleared)
+		float Measurement_ = Descriptor_.Offset + Descriptor_.Scale * (float)(Raw_[i] & Descriptor_.Raw_Mask) / 65536;
+
+		// Control For Sensor Range and Calibrate Data
+		Value_[i] = (Measurement_ < Descriptor_.Range_Min or Measurement_ > Descriptor_.Range_Max) ? -106 : (Descriptor_.Calibration_a * Measurement_) + Descriptor_.Calibration_b;
+
+	}
+
+}
+static void Pressure_Scalar(const uint32_t * Raw_, float * Value_, size_t i, const size_t Count_) {
+
+	// Convert Codes
+	for (; i < Count_; i++) {
+
+		// Calculate Pressure (mBar)
+		float Pressure_ = ((float)ENV_MPL3115A2_P_CALIBRATION_A * ((float)(Raw_[i] & ENV_BATCH_PRESSURE_MASK) / 4 / 100)) + (float)ENV_MPL3115A2_P_CALIBRATION_B;
+
+		// Control For Sensor Range
+		Value_[i] = (Pressure_ <= ENV_BATCH_PRESSURE_MIN or Pressure_ >= ENV_BATCH_PRESSURE_MAX) ? -108 : Pressure_;
+
+	}
+
+}
+static void Light_Scalar(const uint16_t * CH0_, const uint16_t * CH1_, float * Value_, size_t i, const size_t Count_, const uint8_t Integrate_Time_, const uint8_t Gain_) {
+
+	// Convert Counts With Driver Formula
+	for (; i < Count_; i++) Value_[i] = Environment_TSL2561::Lux(CH0_[i], CH1_[i], Integrate_Time_, Gain_);
+
+}
+
+#if defined(ENV_BATCH_X86)
+
+// ************************************************************
+// SSE4.1 Kernels (4 codes per step)
+// ************************************************************
+
+__attribute__((target("sse4.1"))) static size_t Convert_SSE(const Environment_Descriptor & Descriptor_, const uint16_t * Raw_, float * Value_, const size_t Count_) {
+
+	// Set Descriptor Constants (division by 65536 is an exact scale)
+	const __m128i Mask_ = _mm_set1_epi32(Descriptor_.Raw_Mask);
+	const __m128 Offset_ = _mm_set1_ps(Descriptor_.Offset);
+	const __m128 Scale_ = _mm_set1_ps(Descriptor_.Scale);
+	const __m128 Step_ = _mm_set1_ps(1.0f / 65536);
+	const __m128 Min_ = _mm_set1_ps(Descriptor_.Range_Min);
+	const __m128 Max_ = _mm_set1_ps(Descriptor_.Range_Max);
+	const __m128 Calibration_a_ = _mm_set1_ps(Descriptor_.Calibration_a);
+	const __m128 Calibration_b_ = _mm_set1_ps(Descriptor_.Calibration_b);
+	const __m128 Error_ = _mm_set1_ps(-106);
+
+	// Convert Codes
+	size_t i = 0;
+	for (; i + 4 <= Count_; i += 4) {
+
+		// Load Codes (status bits cleared)
+		__m128i Code_ = _mm_and_si128(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)&Raw_[i])), Mask_);
+
+		// Calculate Measurement
+		__m128 Measurement_ = _mm_add_ps(Offset_, _mm_mul_ps(_mm_mul_ps(Scale_, _mm_cvtepi32_ps(Code_)), Step_));
+
+		// Control For Sensor Range
+		__m128 Range_Error_ = _mm_or_ps(_mm_cmplt_ps(Measurement_, Min_), _mm_cmpgt_ps(Measurement_, Max_));
+
+		// Calibrate Data
+		Measurement_ = _mm_add_ps(_mm_mul_ps(Calibration_a_, Measurement_), Calibration_b_);
+
+		// Store Values
+		_mm_storeu_ps(&Value_[i], _mm_blendv_ps(Measurement_, Error_, Range_Error_));
+
+	}
+
+	// End Function (converted count)
+	return(i);
+
+}
+__attribute__((target("sse4.1"))) static size_t Pressure_SSE(const uint32_t * Raw_, float * Value_, const size_t Count_) {
+
+	// Set Constants
+	const __m128i Mask_ = _mm_set1_epi32(ENV_BATCH_PRESSURE_MASK);
+	const __m128 Quarter_ = _mm_set1_ps(0.25f);
+	const __m128 Hundred_ = _mm_set1_ps(100);
+	const __m128 Calibration_a_ = _mm_set1_ps((float)ENV_MPL3115A2_P_CALIBRATION_A);
+	const __m128 Calibration_b_ = _mm_set1_ps((float)ENV_MPL3115A2_P_CALIBRATION_B);
+	const __m128 Min_ = _mm_set1_ps(ENV_BATCH_PRESSURE_MIN);
+	const __m128 Max_ = _mm_set1_ps(ENV_BATCH_PRESSURE_MAX);
+	const __m128 Error_ = _mm_set1_ps(-108);
+
+	// Convert Codes
+	size_t i = 0;
+	for (; i + 4 <= Count_; i += 4) {
+
+		// Load Codes
+		__m128 Code_ = _mm_cvtepi32_ps(_mm_and_si128(_mm_loadu_si128((const __m128i *)&Raw_[i]), Mask_));
+
+		// Calculate Pressure (mBar, division by 4 is an exact scale)
+		__m128 Pressure_ = _mm_add_ps(_mm_mul_ps(Calibration_a_, _mm_div_ps(_mm_mul_ps(Code_, Quarter_), Hundred_)), Calibration_b_);
+
+		// Control For Sensor Range
+		__m128 Range_Error_ = _mm_or_ps(_mm_cmple_ps(Pressure_, Min_), _mm_cmpge_ps(Pressure_, Max_));
+
+		// Store Values
+		_mm_storeu_ps(&Value_[i], _mm_blendv_ps(Pressure_, Error_, Range_Error_));
+
+	}
+
+	// End Function (converted count)
+	return(i);
+
+}
+__attribute__((target("sse4.1"))) static inline __m128i Divide_SSE(const __m128i Dividend_, const __m128i Divisor_) {
+
+	// Unsigned to Double Offsets
+	const __m128i Sign_ = _mm_set1_epi32((int)0x80000000);
+	const __m128d Half_Range_ = _mm_set1_pd(2147483648.0);
+
+	// Convert Unsigned Lanes to Double (exact)
+	__m128i Dividend_Sign_ = _mm_xor_si128(Dividend_, Sign_);
+	__m128i Divisor_Sign_ = _mm_xor_si128(Divisor_, Sign_);
+	__m128d Dividend_Low_ = _mm_add_pd(_mm_cvtepi32_pd(Dividend_Sign_), Half_Range_);
+	__m128d Dividend_High_ = _mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(Dividend_Sign_, 8)), Half_Range_);
+	__m128d Divisor_Low_ = _mm_add_pd(_mm_cvtepi32_pd(Divisor_Sign_), Half_Range_);
+	__m128d Divisor_High_ = _mm_add_pd(_mm_cvtepi32_pd(_mm_srli_si128(Divisor_Sign_, 8)), Half_Range_);
+
+	// Divide and Round Down (quotient of 32 bit values is exact after rounding down)
+	__m128i Low_ = _mm_cvttpd_epi32(_mm_sub_pd(_mm_floor_pd(_mm_div_pd(Dividend_Low_, Divisor_Low_)), Half_Range_));
+	__m128i High_ = _mm_cvttpd_epi32(_mm_sub_pd(_mm_floor_pd(_mm_div_pd(Dividend_High_, Divisor_High_)), Half_Range_));
+
+	// Combine Lanes (zero divisor gives zero)
+	__m128i Quotient_ = _mm_xor_si128(_mm_unpacklo_epi64(Low_, High_), Sign_);
+	return(_mm_andnot_si128(_mm_cmpeq_epi32(Divisor_, _mm_setzero_si128()), Quotient_));
+
+}
+__attribute__((target("sse4.1"))) static size_t Light_SSE(const uint16_t * CH0_, const uint16_t * CH1_, float * Value_, const size_t Count_, const uint32_t Scale_) {
+
+	// Set Constants
+	const __m128i Channel_Scale_ = _mm_set1_epi32((int)Scale_);
+	const __m128i One_ = _mm_set1_epi32(1);
+	const __m128i Round_ = _mm_set1_epi32(1 << 13);
+
+	// Convert Counts
+	size_t i = 0;
+	for (; i + 4 <= Count_; i += 4) {
+
+		// Scale Channel Values (32 bit wrap like the device)
+		__m128i Channel_0_ = _mm_srli_epi32(_mm_mullo_epi32(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)&CH0_[i])), Channel_Scale_), 10);
+		__m128i Channel_1_ = _mm_srli_epi32(_mm_mullo_epi32(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)&CH1_[i])), Channel_Scale_), 10);
+
+		// Find and Round the Ratio of the Channel Values
+		__m128i Ratio_ = _mm_srli_epi32(_mm_add_epi32(Divide_SSE(_mm_slli_epi32(Channel_1_, 10), Channel_0_), One_), 1);
+
+		// Select B and M From Ladder (ratio fits 31 bits, lowest limit wins)
+		__m128i B_ = _mm_setzero_si128();
+		__m128i M_ = _mm_setzero_si128();
+		for (int8_t k = ENV_BATCH_LADDER_COUNT - 1; k >= 0; k--) {
+
+			// Keep Lanes Above Limit
+			__m128i Above_ = _mm_cmpgt_epi32(Ratio_, _mm_set1_epi32((int)ENV_BATCH_LADDER_RATIO[k]));
+			B_ = _mm_blendv_epi8(_mm_set1_epi32((int)ENV_BATCH_LADDER_B[k]), B_, Above_);
+			M_ = _mm_blendv_epi8(_mm_set1_epi32((int)ENV_BATCH_LADDER_M[k]), M_, Above_);
+
+		}
+
+		// Calculate Lux, Round LSB and Strip Off Fractional Portion
+		__m128i Lux_ = _mm_sub_epi32(_mm_mullo_epi32(Channel_0_, B_), _mm_mullo_epi32(Channel_1_, M_));
+		Lux_ = _mm_srli_epi32(_mm_add_epi32(Lux_, Round_), 14);
+
+		// Store Values
+		_mm_storeu_ps(&Value_[i], _mm_cvtepi32_ps(Lux_));
+
+	}
+
+	// End Function (converted count)
+	return(i);
+
+}
+
+// ************************************************************
+// AVX2 Kernels (8 codes per step)
+// ************************************************************
+
+__attribute__((target("avx2"))) static size_t Convert_AVX2(const Environment_Descriptor & Descriptor_, const uint16_t * Raw_, float * Value_, const size_t Count_) {
+
+	// Set Descriptor Constants (division by 65536 is an exact scale)
+	const __m256i Mask_ = _mm256_set1_epi32(Descriptor_.Raw_Mask);
+	const __m256 Offset_ = _mm256_set1_ps(Descriptor_.Offset);
+	const __m256 Scale_ = _mm256_set1_ps(Descriptor_.Scale);
+	const __m256 Step_ = _mm256_set1_ps(1.0f / 65536);
+	const __m256 Min_ = _mm256_set1_ps(Descriptor_.Range_Min);
+	const __m256 Max_ = _mm256_set1_ps(Descriptor_.Range_Max);
+	const __m256 Calibration_a_ = _mm256_set1_ps(Descriptor_.Calibration_a);
+	const __m256 Calibration_b_ = _mm256_set1_ps(Descriptor_.Calibration_b);
+	const __m256 Error_ = _mm256_set1_ps(-106);
+
+	// Convert Codes
+	size_t i = 0;
+	for (; i + 8 <= Count_; i += 8) {
+
+		// Load Codes (status bits cleared)
+		__m256i Code_ = _mm256_and_si256(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&Raw_[i])), Mask_);
+
+		// Calculate Measurement
+		__m256 Measurement_ = _mm256_add_ps(Offset_, _mm256_mul_ps(_mm256_mul_ps(Scale_, _mm256_cvtepi32_ps(Code_)), Step_));
+
+		// Control For Sensor Range
+		__m256 Range_Error_ = _mm256_or_ps(_mm256_cmp_ps(Measurement_, Min_, _CMP_LT_OQ), _mm256_cmp_ps(Measurement_, Max_, _CMP_GT_OQ));
+
+		// Calibrate Data
+		Measurement_ = _mm256_add_ps(_mm256_mul_ps(Calibration_a_, Measurement_), Calibration_b_);
+
+		// Store Values
+		_mm256_storeu_ps(&Value_[i], _mm256_blendv_ps(Measurement_, Error_, Range_Error_));
+
+	}
+
+	// End Function (converted count)
+	return(i);
+
+}
+__attribute__((target("avx2"))) static size_t Pressure_AVX2(const uint32_t * Raw_, float * Value_, const size_t Count_) {
+
+	// Set Constants
+	const __m256i Mask_ = _mm256_set1_epi32(ENV_BATCH_PRESSURE_MASK);
+	const __m256 Quarter_ = _mm256_set1_ps(0.25f);
+	const __m256 Hundred_ = _mm256_set1_ps(100);
+	const __m256 Calibration_a_ = _mm256_set1_ps((float)ENV_MPL3115A2_P_CALIBRATION_A);
+	const __m256 Calibration_b_ = _mm256_set1_ps((float)ENV_MPL3115A2_P_CALIBRATION_B);
+	const __m256 Min_ = _mm256_set1_ps(ENV_BATCH_PRESSURE_MIN);
+	const __m256 Max_ = _mm256_set1_ps(ENV_BATCH_PRESSURE_MAX);
+	const __m256 Error_ = _mm256_set1_ps(-108);
+
+	// Convert Codes
+	size_t i = 0;
+	for (; i + 8 <= Count_; i += 8) {
+
+		// Load Codes
+		__m256 Code_ = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_loadu_si256((const __m256i *)&Raw_[i]), Mask_));
+
+		// Calculate Pressure (mBar, division by 4 is an exact scale)
+		__m256 Pressure_ = _mm256_add_ps(_mm256_mul_ps(Calibration_a_, _mm256_div_ps(_mm256_mul_ps(Code_, Quarter_), Hundred_)), Calibration_b_);
+
+		// Control For Sensor Range
+		__m256 Range_Error_ = _mm256_or_ps(_mm256_cmp_ps(Pressure_, Min_, _CMP_LE_OQ), _mm256_cmp_ps(Pressure_, Max_, _CMP_GE_OQ));
+
+		// Store Values
+		_mm256_storeu_ps(&Value_[i], _mm256_blendv_ps(Pressure_, Error_, Range_Error_));
+
+	}
+
+	// End Function (converted count)
+	return(i);
+
+}
+__attribute__((target("avx2"))) static inline __m128i Divide_AVX2(const __m128i Dividend_, const __m128i Divisor_) {
+
+	// Unsigned to Double Offsets
+	const __m128i Sign_ = _mm_set1_epi32((int)0x80000000);
+	const __m256d Half_Range_ = _mm256_set1_pd(2147483648.0);
+
+	// Convert Unsigned Lanes to Double (exact)
+	__m256d Dividend_Double_ = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(Dividend_, Sign_)), Half_Range_);
+	__m256d Divisor_Double_ = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(Divisor_, Sign_)), Half_Range_);
+
+	// Divide and Round Down (quotient of 32 bit values is exact after rounding down)
+	__m128i Quotient_ = _mm_xor_si128(_mm256_cvttpd_epi32(_mm256_sub_pd(_mm256_floor_pd(_mm256_div_pd(Dividend_Double_, Divisor_Double_)), Half_Range_)), Sign_);
+
+	// Zero Divisor Gives Zero
+	return(_mm_andnot_si128(_mm_cmpeq_epi32(Divisor_, _mm_setzero_si128()), Quotient_));
+
+}
+__attribute__((target("avx2"))) static size_t Light_AVX2(const uint16_t * CH0_, const uint16_t * CH1_, float * Value_, const size_t Count_, const uint32_t Scale_) {
+
+	// Set Constants
+	const __m256i Channel_Scale_ = _mm256_set1_epi32((int)Scale_);
+	const __m256i One_ = _mm256_set1_epi32(1);
+	const __m256i Round_ = _mm256_set1_epi32(1 << 13);
+
+	// Convert Counts
+	size_t i = 0;
+	for (; i + 8 <= Count_; i += 8) {
+
+		// Scale Channel Values (32 bit wrap like the device)
+		__m256i Channel_0_ = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&CH0_[i])), Channel_Scale_), 10);
+		__m256i Channel_1_ = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)&CH1_[i])), Channel_Scale_), 10);
+
+		// Find the Ratio of the Channel Values (four lanes per double division)
+		__m256i Dividend_ = _mm256_slli_epi32(Channel_1_, 10);
+		__m128i Ratio_Low_ = Divide_AVX2(_mm256_castsi256_si128(Dividend_), _mm256_castsi256_si128(Channel_0_));
+		__m128i Ratio_High_ = Divide_AVX2(_mm256_extracti128_si256(Dividend_, 1), _mm256_extracti128_si256(Channel_0_, 1));
+
+		// Round the Ratio Value
+		__m256i Ratio_ = _mm256_srli_epi32(_mm256_add_epi32(_mm256_inserti128_si256(_mm256_castsi128_si256(Ratio_Low_), Ratio_High_, 1), One_), 1);
+
+		// Select B and M From Ladder (ratio fits 31 bits, lowest limit wins)
+		__m256i B_ = _mm256_setzero_si256();
+		__m256i M_ = _mm256_setzero_si256();
+		for (int8_t k = ENV_BATCH_LADDER_COUNT - 1; k >= 0; k--) {
+
+			// Keep Lanes Above Limit
+			__m256i Above_ = _mm256_cmpgt_epi32(Ratio_, _mm256_set1_epi32((int)ENV_BATCH_LADDER_RATIO[k]));
+			B_ = _mm256_blendv_epi8(_mm256_set1_epi32((int)ENV_BATCH_LADDER_B[k]), B_, Above_);
+			M_ = _mm256_blendv_epi8(_mm256_set1_epi32((int)ENV_BATCH_LADDER_M[k]), M_, Above_);
+
+		}
+
+		// Calculate Lux, Round LSB and Strip Off Fractional Portion
+		__m256i Lux_ = _mm256_sub_epi32(_mm256_mullo_epi32(Channel_0_, B_), _mm256_mullo_epi32(Channel_1_, M_));
+		Lux_ = _mm256_srli_epi32(_mm256_add_epi32(Lux_, Round_), 14);
+
+		// Store Values
+		_mm256_storeu_ps(&Value_[i], _mm256_cvtepi32_ps(Lux_));
+
+	}
+
+	// End Function (converted count)
+	return(i);
+
+}
+
+#endif /* defined(ENV_BATCH_X86) */
+
+// Conversion Functions
+void Environment_Batch::Convert(const Environment_Descriptor * Descriptor_P_, const uint16_t * Raw_, float * Value_, const size_t Count_) {
+
+	// Read Descriptor
+	Environment_Descriptor Descriptor_;
+	memcpy_P(&Descriptor_, Descriptor_P_, sizeof(Environment_Descriptor));
+
+	// Converted Count
+	size_t Done_ = 0;
+
+	// Run Vector Kernel
+	#if defined(ENV_BATCH_X86)
+	if (Kernel() == ENV_BATCH_AVX2) Done_ = Convert_AVX2(Descriptor_, Raw_, Value_, Count_);
+	if (Kernel() == ENV_BATCH_SSE) Done_ = Convert_SSE(Descriptor_, Raw_, Value_, Count_);
+	#endif
+
+	// Convert Remaining Codes
+	Convert_Scalar(Descriptor_, Raw_, Value_, Done_, Count_);
+
+}
+void Environment_Batch::Pressure(const uint32_t * Raw_, float * Value_, const size_t Count_) {
+
+	// Converted Count
+	size_t Done_ = 0;
+
+	// Run Vector Kernel
+	#if defined(ENV_BATCH_X86)
+	if (Kernel() == ENV_BATCH_AVX2) Done_ = Pressure_AVX2(Raw_, Value_, Count_);
+	if (Kernel() == ENV_BATCH_SSE) Done_ = Pressure_SSE(Raw_, Value_, Count_);
+	#endif
+
+	// Convert Remaining Codes
+	Pressure_Scalar(Raw_, Value_, Done_, Count_);
+
+}
+void Environment_Batch::Light(const uint16_t * CH0_, const uint16_t * CH1_, float * Value_, const size_t Count_, const uint8_t Integrate_Time_, const uint8_t Gain_) {
+
+	// Get Channel Scale
+	uint32_t Scale_ = Scale(Integrate_Time_, Gain_);
+
+	// Control for Integration Time
+	if (Scale_ == 0) {
+
+		// Set Error
+		for (size_t i = 0; i < Count_; i++) Value_[i] = -100;
+
+		// End Function
+		return;
+
+	}
+
+	// Converted Count
+	size_t Done_ = 0;
+
+	// Run Vector Kernel
+	#if defined(ENV_BATCH_X86)
+	if (Kernel() == ENV_BATCH_AVX2) Done_ = Light_AVX2(CH0_, CH1_, Value_, Count_, Scale_);
+	if (Kernel() == ENV_BATCH_SSE) Done_ = Light_SSE(CH0_, CH1_, Value_, Count_, Scale_);
+	#endif
+
+	// Convert Remaining Counts
+	Light_Scalar(CH0_, CH1_, Value_, Done_, Count_, Integrate_Time_, Gain_);
+
+}
+
+// Kernel Functions
+uint8_t Environment_Batch::Kernel(void) {
+
+	// Detect Kernel on First Use
+	if (Active == 0xFF) Active = Detect();
+
+	// End Function
+	return(Active);
+
+}
+uint8_t Environment_Batch::Set_Kernel(const uint8_t Kernel_) {
+
+	// Limit Kernel to CPU
+	uint8_t Best_ = Detect();
+	Active = (Kernel_ < Best_) ? Kernel_ : Best_;
+
+	// End Function
+	return(Active);
+
+}
+
+// Private Functions
+uint8_t Environment_Batch::Detect(void) {
+
+	// Control for CPU Features
+	#if defined(ENV_BATCH_X86)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) return(ENV_BATCH_AVX2);
+	if (__builtin_cpu_supports("sse4.1")) return(ENV_BATCH_SSE);
+	#endif
+
+	// End Function
+	return(ENV_BATCH_SCALAR);
+
+}
+uint32_t Environment_Batch::Scale(const uint8_t Integrate_Time_, const uint8_t Gain_) {
+
+	// Scale for Integration Time (driver values)
+	uint32_t Scale_ = 0;
+	if (Integrate_Time_ == 1) Scale_ = 0x7517;
+	if (Integrate_Time_ == 2) Scale_ = 0x0FE7;
+	if (Integrate_Time_ == 3) Scale_ = (1 << 10);
+
+	// Scale for Gain
+	if (Gain_ == 2) Scale_ = Scale_ << 4;
+
+	// End Function
+	return(Scale_);
+
+}
+
+#endif /* defined(ENV_PLATFORM_LINUX) */
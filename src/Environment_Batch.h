@@ -0,0 +1,88 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Batch Conversion.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Batch__
+#define __Environment_Batch__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// Define Acquisition Engine
+#include "Environment_Descriptor.h"
+
+#if defined(ENV_PLATFORM_LINUX)
+
+// ************************************************************
+// Batch Conversion
+// ************************************************************
+//
+//	Converts arrays of logged raw codes with the on device formulas, every
+//	value bit for bit the same as a single sensor read (single precision,
+//	32 bit integer arithmetic, same operation order, no fused multiply add).
+//
+//	Raw Codes	: SHT21 and HDC2010 16 bit results as combined by the driver
+//				  (SHT21 MSB first, HDC2010 LSB first), MPL3115A2 20 bit
+//				  pressure (OUT_P >> 4), TSL2561 channel 0 and 1 counts.
+//
+//	Calibration	: a descriptor in RAM with new calibration or range values
+//				  converts with them (flash is ordinary memory on Linux).
+
+// Conversion Kernels
+#define ENV_BATCH_SCALAR			0		// Portable loop
+#define ENV_BATCH_SSE				1		// SSE4.1, 4 codes per step
+#define ENV_BATCH_AVX2				2		// AVX2, 8 codes per step
+
+class Environment_Batch
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	// Descriptor Channels (SHT21 and HDC2010, range errors are -106)
+	static void Convert(const Environment_Descriptor * Descriptor_P_, const uint16_t * Raw_, float * Value_, const size_t Count_);
+
+	// MPL3115A2 Pressure (mBar, range errors are -108)
+	static void Pressure(const uint32_t * Raw_, float * Value_, const size_t Count_);
+
+	// TSL2561 Light (integration time and gain codes of the driver, lux)
+	static void Light(const uint16_t * CH0_, const uint16_t * CH1_, float * Value_, const size_t Count_, const uint8_t Integrate_Time_ = 1, const uint8_t Gain_ = 1);
+
+	// Kernel Selection (best kernel of the CPU unless limited, returns the kernel in use)
+	static uint8_t Kernel(void);
+	static uint8_t Set_Kernel(const uint8_t Kernel_);
+
+private:
+
+	// ************************************************************
+	// Batch Variables
+	// ************************************************************
+
+	// Kernel in Use (0xFF until detected)
+	static uint8_t Active;
+
+	// ************************************************************
+	// Private Functions
+	// ************************************************************
+
+	// CPU Kernel
+	static uint8_t Detect(void);
+
+	// TSL2561 Channel Scale (0 for an unknown integration time)
+	static uint32_t Scale(const uint8_t Integrate_Time_, const uint8_t Gain_);
+
+};
+
+#endif /* defined(ENV_PLATFORM_LINUX) */
+
+#endif /* defined(__Environment_Batch__) */
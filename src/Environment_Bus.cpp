@@ -0,0 +1,345 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - I2C Bus Layer.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Bus.h"
+
+Environment_Bus::Environment_Bus(Environment_Transport & Transport_) {
+
+	// Set Platform Transport
+	Transport = &Transport_;
+
+	// No Channel Selected
+	Active_Mux = ENV_MUX_NONE;
+	Active_Channel = ENV_MUX_CHANNEL_NONE;
+
+	// Clock Untouched by Default
+	Clock_Policy = ENV_CLOCK_KEEP;
+	Caller_Clock = ENV_CLOCK_STANDARD;
+	Bus_Limit = ENV_CLOCK_FAST_MODE;
+	Active_Clock = 0;
+	Session_Depth = 0;
+
+	// Default Timeout With Recovery (applied by first transaction)
+	Timeout = ENV_BUS_TIMEOUT_DEFAULT;
+	Timeout_Set = false;
+	Bounded = false;
+	Auto_Recover = true;
+	Recoveries = 0;
+
+}
+
+// Clock Functions
+void Environment_Bus::Set_Clock_Policy(const uint8_t Policy_, const uint32_t Caller_Clock_, const uint32_t Bus_Limit_) {
+
+	// Set Policy
+	Clock_Policy = Policy_;
+	Caller_Clock = Caller_Clock_;
+	Bus_Limit = Bus_Limit_;
+
+	// Clock State is Unknown
+	Active_Clock = 0;
+
+}
+uint32_t Environment_Bus::Session_Clock(const Environment_Device & Device_) {
+
+	// Start With Bus Limit (cable length, slowest foreign device)
+	uint32_t Clock_ = Bus_Limit;
+
+	// Limit for Device
+	if (Device_.Max_Clock != 0 and Device_.Max_Clock < Clock_) Clock_ = Device_.Max_Clock;
+
+	// Limit for Multiplexer
+	if (Device_.Mux_Address != ENV_MUX_NONE and ENV_MUX_MAX_CLOCK < Clock_) Clock_ = ENV_MUX_MAX_CLOCK;
+
+	// End Function
+	return(Clock_);
+
+}
+uint32_t Environment_Bus::Device_Clock(const Environment_Device & Device_) {
+
+	// Untouched Clock Runs at Caller Clock
+	if (Clock_Policy == ENV_CLOCK_KEEP) return(Caller_Clock);
+
+	// End Function (session clock)
+	return(Session_Clock(Device_));
+
+}
+
+// Session Functions
+void Environment_Bus::Begin(const Environment_Device & Device_) {
+
+	// Count Nested Sessions
+	Session_Depth++;
+
+	// Control for Policy
+	if (Clock_Policy == ENV_CLOCK_KEEP) return;
+
+	// Calculate Session Clock
+	uint32_t Clock_ = Session_Clock(Device_);
+
+	// Set Clock Only When Changed
+	if (Clock_ != Active_Clock) {
+
+		// Set Clock
+		Transport->Set_Clock(Clock_);
+		Active_Clock = Clock_;
+
+	}
+
+}
+void Environment_Bus::End(void) {
+
+	// Control for Nested Sessions
+	if (Session_Depth > 0) Session_Depth--;
+	if (Session_Depth > 0) return;
+
+	// Control for Policy
+	if (Clock_Policy != ENV_CLOCK_FAST) return;
+
+	// Restore Caller Clock
+	if (Active_Clock != Caller_Clock) {
+
+		// Set Clock
+		Transport->Set_Clock(Caller_Clock);
+		Active_Clock = Caller_Clock;
+
+	}
+
+}
+
+// Wait Functions
+void Environment_Bus::Delay(const uint32_t Time_) {
+
+	// Wait Through Transport (recorded and modelled by trace transports)
+	Transport->Delay(Time_);
+
+}
+
+// Timeout and Recovery Functions
+bool Environment_Bus::Set_Timeout(const uint32_t Timeout_, const bool Recover_) {
+
+	// Set Timeout
+	Timeout = Timeout_;
+	Timeout_Set = true;
+
+	// Set Recovery
+	Auto_Recover = Recover_;
+
+	// Set Transport Timeout
+	bool Result_ = Transport->Set_Timeout(Timeout_);
+
+	// Set Bound State
+	Bounded = (Result_ and Timeout_ != 0);
+
+	// End Function
+	return(Result_);
+
+}
+uint32_t Environment_Bus::Get_Timeout(void) {
+
+	// Apply Default Timeout
+	if (!Timeout_Set) Set_Timeout(Timeout, Auto_Recover);
+
+	// End Function (0 when transactions are not bounded)
+	return(Bounded ? Timeout : 0);
+
+}
+uint8_t Environment_Bus::Recover(void) {
+
+	// Count Recovery
+	Recoveries++;
+
+	// Keep Active Multiplexer
+	uint8_t Mux_ = Active_Mux;
+
+	// Clock Out Held Line, STOP and Restart Peripheral
+	uint8_t Result_ = Transport->Recover();
+
+	// Close Multiplexer Channels (multiplexer keeps them through recovery)
+	uint8_t Closed_ = 0x00;
+	if (Result_ == ENV_TRANSPORT_OK and Mux_ != ENV_MUX_NONE) Transport->Write(Mux_, &Closed_, 1);
+
+	// Forget Channel and Clock State
+	Active_Mux = ENV_MUX_NONE;
+	Active_Channel = ENV_MUX_CHANNEL_NONE;
+	Active_Clock = 0;
+
+	// End Function
+	return(Result_);
+
+}
+uint16_t Environment_Bus::Recovery_Count(void) {
+
+	// End Function
+	return(Recoveries);
+
+}
+
+// Multiplexer Functions
+uint8_t Environment_Bus::Select(const Environment_Device & Device_) {
+
+	// Apply Default Timeout (first transaction)
+	if (!Timeout_Set) Set_Timeout(Timeout, Auto_Recover);
+
+	// Control for Active Channel (no bus traffic when already selected)
+	if (Device_.Mux_Address == Active_Mux and (Device_.Mux_Address == ENV_MUX_NONE or Device_.Mux_Channel == Active_Channel)) return(ENV_BUS_OK);
+
+	// Close Previous Multiplexer (same address devices on other muxes must not collide)
+	if (Active_Mux != ENV_MUX_NONE and Active_Mux != Device_.Mux_Address) {
+
+		// Disable All Channels
+		if (Mux_Write(Active_Mux, 0x00) != ENV_BUS_OK) {
+
+			// Forget Channel State
+			Active_Mux = ENV_MUX_NONE;
+			Active_Channel = ENV_MUX_CHANNEL_NONE;
+
+			// End Function
+			return(ENV_BUS_MUX_ERROR);
+
+		}
+
+	}
+
+	// Device on Main Bus
+	if (Device_.Mux_Address == ENV_MUX_NONE) {
+
+		// Set Channel State
+		Active_Mux = ENV_MUX_NONE;
+		Active_Channel = ENV_MUX_CHANNEL_NONE;
+
+		// End Function
+		return(ENV_BUS_OK);
+
+	}
+
+	// Control for Channel
+	if (Device_.Mux_Channel >= ENV_MUX_CHANNEL_COUNT) return(ENV_BUS_MUX_ERROR);
+
+	// Select Channel
+	if (Mux_Write(Device_.Mux_Address, (uint8_t)(1 << Device_.Mux_Channel)) != ENV_BUS_OK) {
+
+		// Forget Channel State
+		Active_Mux = ENV_MUX_NONE;
+		Active_Channel = ENV_MUX_CHANNEL_NONE;
+
+		// End Function
+		return(ENV_BUS_MUX_ERROR);
+
+	}
+
+	// Set Channel State
+	Active_Mux = Device_.Mux_Address;
+	Active_Channel = Device_.Mux_Channel;
+
+	// End Function
+	return(ENV_BUS_OK);
+
+}
+uint8_t Environment_Bus::Deselect(void) {
+
+	// Declare Result Variable
+	uint8_t Result_ = ENV_BUS_OK;
+
+	// Disable All Channels
+	if (Active_Mux != ENV_MUX_NONE) Result_ = Mux_Write(Active_Mux, 0x00);
+
+	// Forget Channel State
+	Active_Mux = ENV_MUX_NONE;
+	Active_Channel = ENV_MUX_CHANNEL_NONE;
+
+	// End Function
+	return(Result_);
+
+}
+
+// Transaction Functions
+uint8_t Environment_Bus::Write(const Environment_Device & Device_, const uint8_t * Data_, const uint8_t Length_) {
+
+	// Select Device Channel
+	uint8_t Result_ = Select(Device_);
+
+	// Control for Select
+	if (Result_ != ENV_BUS_OK) return(Check(Device_, Result_));
+
+	// Send Data
+	return(Check(Device_, Transport->Write(Device_.Address, Data_, Length_)));
+
+}
+uint8_t Environment_Bus::Write_Command(const Environment_Device & Device_, const uint8_t Command_) {
+
+	// Send Command
+	return(Write(Device_, &Command_, 1));
+
+}
+uint8_t Environment_Bus::Write_Register(const Environment_Device & Device_, const uint8_t Register_, const uint8_t Value_) {
+
+	// Set Data
+	uint8_t Data_[2] = {Register_, Value_};
+
+	// Send Data
+	return(Write(Device_, Data_, 2));
+
+}
+uint8_t Environment_Bus::Read(const Environment_Device & Device_, uint8_t * Data_, const uint8_t Length_) {
+
+	// Select Device Channel
+	uint8_t Result_ = Select(Device_);
+
+	// Control for Select
+	if (Result_ != ENV_BUS_OK) return(Check(Device_, Result_));
+
+	// Read Data
+	return(Check(Device_, Transport->Read(Device_.Address, Data_, Length_)));
+
+}
+uint8_t Environment_Bus::Read_Register(const Environment_Device & Device_, const uint8_t Register_, uint8_t * Data_, const uint8_t Length_) {
+
+	// Select Device Channel
+	uint8_t Result_ = Select(Device_);
+
+	// Control for Select
+	if (Result_ != ENV_BUS_OK) return(Check(Device_, Result_));
+
+	// Send Register Address and Read Data With Repeated Start
+	return(Check(Device_, Transport->Write_Read(Device_.Address, &Register_, 1, Data_, Length_)));
+
+}
+
+// Private Functions
+uint8_t Environment_Bus::Mux_Write(const uint8_t Mux_Address_, const uint8_t Channel_Mask_) {
+
+	// Send Channel Mask (channel is switched on STOP)
+	uint8_t Result_ = Transport->Write(Mux_Address_, &Channel_Mask_, 1);
+
+	// Recover Hung Bus
+	if (Result_ == ENV_TRANSPORT_TIMEOUT and Auto_Recover) Recover();
+
+	// End Function
+	return(Result_);
+
+}
+uint8_t Environment_Bus::Check(const Environment_Device & Device_, const uint8_t Result_) {
+
+	// Control for Success
+	if (Result_ == ENV_BUS_OK) return(Result_);
+
+	// Count Device Failure (address NACK is a missing or converting device)
+	if (Result_ != ENV_TRANSPORT_NACK_ADDRESS and Device_.Failures < 0xFFFF) Device_.Failures++;
+
+	// Recover Hung Bus
+	if (Result_ == ENV_TRANSPORT_TIMEOUT and Auto_Recover) Recover();
+
+	// End Function
+	return(Result_);
+
+}
@@ -0,0 +1,151 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - I2C Bus Layer.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Bus__
+#define __Environment_Bus__
+
+// Define Platform Transports
+#include "Environment_Transport.h"
+#include "Environment_Wire.h"
+#include "Environment_Linux.h"
+
+// ************************************************************
+// Bus Definations
+// ************************************************************
+
+// TCA9548A Multiplexer
+#define ENV_MUX_NONE				0x00	// Device is on the main bus
+#define ENV_MUX_TCA9548A			0x70	// TCA9548A base address (0x70 - 0x77)
+#define ENV_MUX_CHANNEL_COUNT		8		// TCA9548A channel count
+#define ENV_MUX_CHANNEL_NONE		0xFF	// No channel selected
+#define ENV_MUX_MAX_CLOCK			400000	// TCA9548A maximum SCL clock (Hz)
+
+// Bus Clock Policy
+#define ENV_CLOCK_KEEP				0		// Never touch the bus clock
+#define ENV_CLOCK_FAST				1		// Fastest safe clock during a session, restore caller clock afterwards
+#define ENV_CLOCK_FAST_HOLD			2		// Fastest safe clock during a session, keep it afterwards
+#define ENV_CLOCK_STANDARD			100000	// I2C standard mode clock (Hz)
+#define ENV_CLOCK_FAST_MODE			400000	// I2C fast mode clock (Hz)
+
+// Bus Result Codes (1 - 4 are Wire.endTransmission codes)
+#define ENV_BUS_OK					ENV_TRANSPORT_OK			// Transaction done
+#define ENV_BUS_READ_ERROR			ENV_TRANSPORT_SHORT_READ	// Device returned less bytes than requested
+#define ENV_BUS_TIMEOUT				ENV_TRANSPORT_TIMEOUT		// Transaction timed out, bus recovered
+#define ENV_BUS_MUX_ERROR			8		// Multiplexer channel select failed
+
+// Bus Timeout (uS, AVR Wire timeout also runs during clock stretching)
+#define ENV_BUS_STRETCH_TIME		85000	// Longest clock stretch of a supported device (SHT21 14 bit T hold master conversion)
+#define ENV_BUS_TIMEOUT_MARGIN		25000	// Margin over longest clock stretch
+#define ENV_BUS_TIMEOUT_DEFAULT		(ENV_BUS_STRETCH_TIME + ENV_BUS_TIMEOUT_MARGIN)	// Suggested transaction timeout
+
+// Device Address Defination
+struct Environment_Device {
+
+	uint8_t		Address;		// 7 bit device address
+	uint8_t		Mux_Address;	// TCA9548A address or ENV_MUX_NONE
+	uint8_t		Mux_Channel;	// TCA9548A channel (0 - 7)
+	uint32_t	Max_Clock;		// Maximum SCL clock of device (Hz)
+	mutable uint16_t	Failures;	// Failed transactions, counted by the bus (address NACK not counted)
+
+};
+
+class Environment_Bus
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Bus(Environment_Transport & Transport_);
+
+	// Clock Policy
+	void Set_Clock_Policy(const uint8_t Policy_, const uint32_t Caller_Clock_ = ENV_CLOCK_STANDARD, const uint32_t Bus_Limit_ = ENV_CLOCK_FAST_MODE);
+	uint32_t Session_Clock(const Environment_Device & Device_);
+	uint32_t Device_Clock(const Environment_Device & Device_);
+
+	// Session
+	void Begin(const Environment_Device & Device_);
+	void End(void);
+
+	// Device Wait
+	void Delay(const uint32_t Time_);
+
+	// Timeout and Recovery (ENV_BUS_TIMEOUT_DEFAULT with recovery until set, 0 waits forever, false when the transport can not bound transactions)
+	bool Set_Timeout(const uint32_t Timeout_ = ENV_BUS_TIMEOUT_DEFAULT, const bool Recover_ = true);
+	uint32_t Get_Timeout(void);
+	uint8_t Recover(void);
+	uint16_t Recovery_Count(void);
+
+	// Multiplexer
+	uint8_t Select(const Environment_Device & Device_);
+	uint8_t Deselect(void);
+
+	// Transactions
+	uint8_t Write(const Environment_Device & Device_, const uint8_t * Data_, const uint8_t Length_);
+	uint8_t Write_Command(const Environment_Device & Device_, const uint8_t Command_);
+	uint8_t Write_Register(const Environment_Device & Device_, const uint8_t Register_, const uint8_t Value_);
+	uint8_t Read(const Environment_Device & Device_, uint8_t * Data_, const uint8_t Length_);
+	uint8_t Read_Register(const Environment_Device & Device_, const uint8_t Register_, uint8_t * Data_, const uint8_t Length_);
+
+private:
+
+	// ************************************************************
+	// Bus Variables
+	// ************************************************************
+
+	// Platform Transport
+	Environment_Transport * Transport;
+
+	// Active Multiplexer Channel
+	uint8_t Active_Mux;
+	uint8_t Active_Channel;
+
+	// Clock Variables
+	uint8_t Clock_Policy;
+	uint32_t Caller_Clock;
+	uint32_t Bus_Limit;
+	uint32_t Active_Clock;
+	uint8_t Session_Depth;
+
+	// Timeout Variables (applied by first transaction, transport may be constructed later)
+	uint32_t Timeout;
+	bool Timeout_Set;
+	bool Bounded;
+
+	// Recovery Variables
+	bool Auto_Recover;
+	uint16_t Recoveries;
+
+	// Raw Transactions
+	uint8_t Mux_Write(const uint8_t Mux_Address_, const uint8_t Channel_Mask_);
+	uint8_t Check(const Environment_Device & Device_, const uint8_t Result_);
+
+};
+
+// Scoped Bus Session (sets session clock, restores caller clock on exit)
+class Environment_Bus_Session
+{
+public:
+
+	Environment_Bus_Session(Environment_Bus & Bus_, const Environment_Device & Device_) : Bus(Bus_) { Bus.Begin(Device_); }
+	~Environment_Bus_Session(void) { Bus.End(); }
+
+private:
+
+	Environment_Bus & Bus;
+
+};
+
+extern Environment_Bus Environment_I2C;
+
+#endif /* defined(__Environment_Bus__) */
@@ -0,0 +1,100 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Reading Cache.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Cache.h"
+
+Environment_Cache::Environment_Cache(void) {
+
+	// Cache Disabled by Default
+	for (uint8_t i = 0; i < ENV_CHANNEL_COUNT; i++) {
+
+		// Clear Channel
+		Reading[i] = {0, 0, 0, 0, 0, 0, 0, 0};
+		Max_Age[i] = 0;
+
+	}
+
+	// No Valid Reading
+	Valid = 0x00;
+
+}
+
+// Configuration Functions
+void Environment_Cache::Set_Max_Age(const uint8_t Channel_, const uint32_t Max_Age_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return;
+
+	// Set Freshness Window
+	Max_Age[Channel_] = Max_Age_;
+
+}
+
+// Cache Functions
+bool Environment_Cache::Fresh(const uint8_t Channel_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return(false);
+
+	// Control for Cache Enable and Valid Reading
+	if (Max_Age[Channel_] == 0 or (Valid & (1 << Channel_)) == 0) return(false);
+
+	// Control for Age (overflow safe)
+	return((uint32_t)(millis() - Reading[Channel_].Time) < Max_Age[Channel_]);
+
+}
+void Environment_Cache::Store(const uint8_t Channel_, const Environment_Reading & Reading_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return;
+
+	// Store Reading
+	Reading[Channel_] = Reading_;
+
+	// Only Successful Readings are Served From Cache
+	if (Reading_.Error == 0) {
+		Valid |= (1 << Channel_);
+	} else {
+		Valid &= ~(1 << Channel_);
+	}
+
+}
+void Environment_Cache::Invalidate(const uint8_t Channel_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return;
+
+	// Clear Valid Flag
+	Valid &= ~(1 << Channel_);
+
+}
+void Environment_Cache::Clear(void) {
+
+	// Clear All Valid Flags
+	Valid = 0x00;
+
+}
+const Environment_Reading & Environment_Cache::Get(const uint8_t Channel_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return(Reading[0]);
+
+	// End Function
+	return(Reading[Channel_]);
+
+}
+const Environment_Reading * Environment_Cache::Table(void) {
+
+	// End Function
+	return(Reading);
+
+}
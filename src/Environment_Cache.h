@@ -0,0 +1,63 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Reading Cache.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Cache__
+#define __Environment_Cache__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+#include "Environment_Reading.h"
+
+class Environment_Cache
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Cache(void);
+
+	// Freshness Window (0 disables cache for channel)
+	void Set_Max_Age(const uint8_t Channel_, const uint32_t Max_Age_);
+
+	// Cache Functions
+	bool Fresh(const uint8_t Channel_);
+	void Store(const uint8_t Channel_, const Environment_Reading & Reading_);
+	void Invalidate(const uint8_t Channel_);
+	void Clear(void);
+
+	// Last Reading (fresh, stale or error)
+	const Environment_Reading & Get(const uint8_t Channel_);
+
+	// Reading Table (ENV_CHANNEL_COUNT readings, channel ID order)
+	const Environment_Reading * Table(void);
+
+private:
+
+	// ************************************************************
+	// Cache Variables
+	// ************************************************************
+
+	// Channel Readings
+	Environment_Reading Reading[ENV_CHANNEL_COUNT];
+
+	// Channel Freshness Window (mS)
+	uint32_t Max_Age[ENV_CHANNEL_COUNT];
+
+	// Channel Valid Flags (bit per channel)
+	uint8_t Valid;
+
+};
+
+#endif /* defined(__Environment_Cache__) */
@@ -0,0 +1,115 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Deadband Change Detector.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Deadband.h"
+
+Environment_Deadband::Environment_Deadband(void) {
+
+	// Report Every Reading by Default
+	Set(0, 0, 0, 0);
+
+}
+
+// Configuration Functions
+void Environment_Deadband::Set(const float Absolute_, const float Relative_, const float Hysteresis_, const uint32_t Heartbeat_) {
+
+	// Set Band (negative values disable the part)
+	Absolute = (Absolute_ > 0) ? Absolute_ : 0;
+	Relative = (Relative_ > 0) ? Relative_ : 0;
+	Hysteresis = (Hysteresis_ > 0) ? Hysteresis_ : 0;
+
+	// Set Heartbeat (mS, 0 disables)
+	Heartbeat = Heartbeat_;
+
+	// Next Reading is Reported
+	Reset();
+
+}
+void Environment_Deadband::Reset(void) {
+
+	// Clear Last Report
+	Reference = 0;
+	Reference_Time = 0;
+	Reference_Error = 0;
+	Direction = 0;
+	Initialized = false;
+
+}
+
+// Detection Functions
+bool Environment_Deadband::Check(const Environment_Reading & Reading_) {
+
+	// Control for Reading (empty cache slot)
+	if (Reading_.Count == 0 and Reading_.Error == 0) return(false);
+
+	// Control for Reading Already Reported
+	if (Initialized and Reading_.Time == Reference_Time) return(false);
+
+	// Declare Decision
+	bool Report_ = false;
+	int8_t Direction_ = Direction;
+
+	// First Reading
+	if (!Initialized) Report_ = true;
+
+	// Error State Change (error codes are never compared as values)
+	else if (Reading_.Error != Reference_Error) Report_ = true;
+
+	// Heartbeat (overflow safe)
+	else if (Heartbeat != 0 and (uint32_t)(Reading_.Time - Reference_Time) >= Heartbeat) Report_ = true;
+
+	// Value Change
+	else if (Reading_.Error == 0) {
+
+		// Calculate Change
+		float Change_ = Reading_.Value - Reference;
+		Direction_ = (Change_ > 0) ? 1 : -1;
+
+		// Calculate Band
+		float Band_ = Relative * fabs(Reference);
+		if (Band_ < Absolute) Band_ = Absolute;
+
+		// Turning Back Needs Hysteresis on Top
+		if (Direction != 0 and Direction_ != Direction) Band_ += Hysteresis;
+
+		// Control for Band
+		Report_ = (fabs(Change_) >= Band_);
+
+	}
+
+	// Control for Report
+	if (!Report_) return(false);
+
+	// Commit Reading (values only from successful readings)
+	if (Reading_.Error == 0) {
+
+		// Set Direction of Value Changes
+		if (Initialized and Reference_Error == 0 and Reading_.Value != Reference) Direction = (Reading_.Value > Reference) ? 1 : -1;
+
+		// Set Reference Value
+		Reference = Reading_.Value;
+
+	}
+	Reference_Time = Reading_.Time;
+	Reference_Error = Reading_.Error;
+	Initialized = true;
+
+	// End Function
+	return(true);
+
+}
+float Environment_Deadband::Reported(void) {
+
+	// End Function
+	return(Reference);
+
+}
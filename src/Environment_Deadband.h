@@ -0,0 +1,75 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Deadband Change Detector.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Deadband__
+#define __Environment_Deadband__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+#include "Environment_Reading.h"
+
+/*
+ *	A reading is worth reporting when:
+ *
+ *	- it is the first reading, or the heartbeat interval since the last
+ *	  report is over,
+ *	- |Value - Reported| >= max(Absolute, Relative * |Reported|), plus
+ *	  Hysteresis when the change turns back against the last reported
+ *	  direction (noise around the band edge can not flip flop),
+ *	- the error state changed (sensor fails or recovers).
+ *
+ *	A positive check commits the reading as the new reference, so the same
+ *	reading is never reported twice.
+ */
+class Environment_Deadband
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Deadband(void);
+
+	// Deadband Configuration (all zero reports every new reading)
+	void Set(const float Absolute_, const float Relative_ = 0, const float Hysteresis_ = 0, const uint32_t Heartbeat_ = 0);
+	void Reset(void);
+
+	// Change Detection
+	bool Check(const Environment_Reading & Reading_);
+
+	// Last Reported Value
+	float Reported(void);
+
+private:
+
+	// ************************************************************
+	// Deadband Variables
+	// ************************************************************
+
+	// Settings
+	float Absolute;
+	float Relative;
+	float Hysteresis;
+	uint32_t Heartbeat;
+
+	// Last Report
+	float Reference;
+	uint32_t Reference_Time;
+	int16_t Reference_Error;
+	int8_t Direction;
+	bool Initialized;
+
+};
+
+#endif /* defined(__Environment_Deadband__) */
@@ -0,0 +1,35 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Default Bus Objects.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Async.h"
+
+// Default Objects of the Combined Sensor (own translation unit, linked only when used, constructed in order)
+#if defined(ENV_PLATFORM_WIRE)
+
+// Default Wire Port
+Environment_Wire Environment_Wire_Port(Wire);
+
+// Default Wire Bus
+Environment_Bus Environment_I2C(Environment_Wire_Port);
+
+#elif defined(ENV_PLATFORM_LINUX)
+
+// Default Adapter
+Environment_Linux Environment_Linux_Port(ENV_LINUX_DEFAULT_DEVICE);
+
+// Default i2c-dev Bus
+Environment_Bus Environment_I2C(Environment_Linux_Port);
+
+#endif
+
+// Default Asynchronous Queue
+Environment_Async Environment_Queue(Environment_I2C);
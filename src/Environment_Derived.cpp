@@ -0,0 +1,185 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Derived Metrics.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Derived.h"
+
+// ************************************************************
+// Lookup Tables
+// ************************************************************
+
+// Tables hold the curvature residual against the chord y = x, so Q19
+// quantization stays below 1e-6 with 16 bit entries.
+
+// Table Size
+#define ENV_LUT_SEGMENTS			128
+#define ENV_LUT_SCALE				524288.0	// 2^19
+
+// Math Constants
+#define ENV_LN2						0.69314718
+#define ENV_LOG2E					1.44269504
+
+// (log2(1 + x) - x) * 2^19, x = i / 128
+static const uint16_t ENV_LOG2_LUT[ENV_LUT_SEGMENTS + 1] PROGMEM = {
+	    0,  1790,  3535,  5235,  6891,  8504, 10074, 11601,
+	13088, 14533, 15938, 17303, 18630, 19917, 21167, 22379,
+	23554, 24692, 25795, 26862, 27894, 28891, 29855, 30785,
+	31681, 32545, 33377, 34177, 34945, 35682, 36389, 37065,
+	37711, 38328, 38915, 39474, 40004, 40506, 40981, 41428,
+	41847, 42240, 42607, 42947, 43261, 43550, 43814, 44053,
+	44266, 44456, 44621, 44763, 44881, 44975, 45047, 45095,
+	45121, 45125, 45106, 45066, 45004, 44921, 44816, 44691,
+	44545, 44378, 44191, 43984, 43757, 43510, 43244, 42959,
+	42654, 42331, 41988, 41628, 41249, 40851, 40436, 40003,
+	39552, 39084, 38598, 38096, 37576, 37039, 36486, 35917,
+	35330, 34728, 34110, 33476, 32826, 32160, 31479, 30782,
+	30070, 29344, 28602, 27845, 27074, 26288, 25488, 24674,
+	23845, 23002, 22146, 21275, 20391, 19493, 18582, 17658,
+	16720, 15769, 14805, 13828, 12838, 11836, 10821,  9794,
+	 8754,  7701,  6637,  5561,  4472,  3372,  2260,  1136,
+	    0
+};
+
+// (1 + x - 2^x) * 2^19, x = i / 128
+static const uint16_t ENV_EXP2_LUT[ENV_LUT_SEGMENTS + 1] PROGMEM = {
+	    0,  1249,  2483,  3701,  4904,  6090,  7261,  8417,
+	 9556, 10679, 11786, 12877, 13951, 15009, 16051, 17076,
+	18084, 19075, 20050, 21008, 21948, 22872, 23778, 24667,
+	25539, 26393, 27229, 28048, 28849, 29632, 30397, 31144,
+	31873, 32584, 33276, 33949, 34604, 35241, 35858, 36457,
+	37037, 37597, 38139, 38661, 39164, 39647, 40111, 40555,
+	40979, 41383, 41767, 42131, 42474, 42798, 43100, 43383,
+	43644, 43885, 44104, 44303, 44481, 44637, 44772, 44885,
+	44977, 45047, 45095, 45121, 45125, 45107, 45066, 45003,
+	44918, 44809, 44678, 44524, 44347, 44147, 43923, 43676,
+	43405, 43111, 42793, 42450, 42084, 41694, 41279, 40839,
+	40375, 39886, 39373, 38834, 38270, 37681, 37066, 36426,
+	35760, 35068, 34351, 33607, 32837, 32040, 31217, 30367,
+	29490, 28586, 27655, 26697, 25712, 24698, 23657, 22588,
+	21492, 20366, 19213, 18031, 16820, 15581, 14313, 13015,
+	11688, 10332,  8946,  7530,  6085,  4609,  3103,  1567,
+	    0
+};
+
+// Interpolate Residual Table for Fraction [0, 1)
+static float LUT_Interpolate(const uint16_t * Table_, const float Fraction_) {
+
+	// Calculate Segment
+	float Position_ = Fraction_ * ENV_LUT_SEGMENTS;
+	uint8_t Index_ = (uint8_t)Position_;
+
+	// Control for Last Segment
+	if (Index_ >= ENV_LUT_SEGMENTS) Index_ = ENV_LUT_SEGMENTS - 1;
+
+	// Read Segment Ends
+	float Low_ = pgm_read_word(&Table_[Index_]);
+	float High_ = pgm_read_word(&Table_[Index_ + 1]);
+
+	// Linear Interpolation
+	return((Low_ + (High_ - Low_) * (Position_ - Index_)) / ENV_LUT_SCALE);
+
+}
+
+// LUT Kernels
+float Environment_Derived::Fast_Log2(const float Value_) {
+
+	// Control for Domain
+	if (!(Value_ > 0)) return(NAN);
+
+	// Split Mantissa [0.5, 1) and Exponent
+	int Exponent_;
+	float Mantissa_ = frexp(Value_, &Exponent_);
+
+	// log2(x) = (e - 1) + log2(1 + f), f = 2m - 1
+	float Fraction_ = 2 * Mantissa_ - 1;
+	return((float)(Exponent_ - 1) + Fraction_ + LUT_Interpolate(ENV_LOG2_LUT, Fraction_));
+
+}
+float Environment_Derived::Fast_Exp2(const float Value_) {
+
+	// Split Integer and Fraction Part
+	float Integer_ = floor(Value_);
+
+	// 2^x = 2^i * 2^f, 2^f = 1 + f - residual
+	float Fraction_ = Value_ - Integer_;
+	return(ldexp(1 + Fraction_ - LUT_Interpolate(ENV_EXP2_LUT, Fraction_), (int)Integer_));
+
+}
+
+// Humidity Metrics
+float Environment_Derived::Dew_Point(const float Temperature_, const float Humidity_) {
+
+	// Control for Domain
+	if (!(Humidity_ > 0)) return(NAN);
+
+	// Magnus Gamma = ln(RH / 100) + b * T / (c + T)
+	float Gamma_ = ENV_LN2 * Fast_Log2(Humidity_ / 100) + (ENV_MAGNUS_B * Temperature_) / (ENV_MAGNUS_C + Temperature_);
+
+	// Calculate Dew Point
+	return((ENV_MAGNUS_C * Gamma_) / (ENV_MAGNUS_B - Gamma_));
+
+}
+float Environment_Derived::Saturation_Pressure(const float Temperature_) {
+
+	// es = a * exp(b * T / (c + T)) [hPa]
+	return(ENV_MAGNUS_A * Fast_Exp2(ENV_LOG2E * (ENV_MAGNUS_B * Temperature_) / (ENV_MAGNUS_C + Temperature_)));
+
+}
+float Environment_Derived::Absolute_Humidity(const float Temperature_, const float Humidity_) {
+
+	// Control for Domain
+	if (!(Humidity_ >= 0)) return(NAN);
+
+	// AH = e / (Rv * T) [g/m3], e = RH * es [hPa], 100 * 1000 / 461.5 = 216.68
+	return(216.68 * (Humidity_ / 100) * Saturation_Pressure(Temperature_) / (Temperature_ + 273.15));
+
+}
+float Environment_Derived::Heat_Index(const float Temperature_, const float Humidity_) {
+
+	// Control for Domain
+	if (!(Humidity_ >= 0)) return(NAN);
+
+	// Convert to Fahrenheit
+	float T_ = Temperature_ * 1.8 + 32;
+	float RH_ = Humidity_;
+
+	// Steadman Simple Formula
+	float HI_ = 0.5 * (T_ + 61 + ((T_ - 68) * 1.2) + (RH_ * 0.094));
+
+	// Rothfusz Regression Above 80 F
+	if ((HI_ + T_) / 2 >= 80) {
+
+		// Calculate Regression
+		HI_ = -42.379 + 2.04901523 * T_ + 10.14333127 * RH_ - 0.22475541 * T_ * RH_ - 0.00683783 * T_ * T_ - 0.05481717 * RH_ * RH_ + 0.00122874 * T_ * T_ * RH_ + 0.00085282 * T_ * RH_ * RH_ - 0.00000199 * T_ * T_ * RH_ * RH_;
+
+		// Low Humidity Adjustment
+		if (RH_ < 13 and T_ >= 80 and T_ <= 112) HI_ -= ((13 - RH_) / 4) * sqrt((17 - fabs(T_ - 95)) / 17);
+
+		// High Humidity Adjustment
+		if (RH_ > 85 and T_ >= 80 and T_ <= 87) HI_ += ((RH_ - 85) / 10) * ((87 - T_) / 5);
+
+	}
+
+	// Convert to Celsius
+	return((HI_ - 32) / 1.8);
+
+}
+
+// Pressure Metrics
+float Environment_Derived::Altitude(const float Pressure_, const float Sea_Level_Pressure_) {
+
+	// Control for Domain
+	if (!(Pressure_ > 0) or !(Sea_Level_Pressure_ > 0)) return(NAN);
+
+	// h = 44330.77 * (1 - (P / P0)^0.190263) [m]
+	return(44330.77 * (1 - Fast_Exp2(0.190263 * Fast_Log2(Pressure_ / Sea_Level_Pressure_))));
+
+}
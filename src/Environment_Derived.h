@@ -0,0 +1,68 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Derived Metrics.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Derived__
+#define __Environment_Derived__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// ************************************************************
+// Derived Metric Definations
+// ************************************************************
+
+// Magnus Coefficients (Sonntag 1990, over water, -45 - 60 C)
+#define ENV_MAGNUS_A				6.112	// hPa
+#define ENV_MAGNUS_B				17.62
+#define ENV_MAGNUS_C				243.12	// C
+
+// International Standard Atmosphere
+#define ENV_SEA_LEVEL_PRESSURE		1013.25	// hPa
+
+/*
+ *	All metrics use PROGMEM log2 / exp2 tables (128 segments, 16 bit, linear
+ *	interpolation) instead of log(), exp() and pow(). Maximum error against the
+ *	exact formula evaluated with libm in double precision (0.05 C, 0.25 %RH
+ *	and 0.01 hPa grid):
+ *
+ *	Dew_Point			: 0.0002 C		(-40 - 60 C, 1 - 100 %RH)
+ *	Saturation_Pressure	: 0.0005 %		(-40 - 60 C)
+ *	Absolute_Humidity	: 0.0005 %		(-40 - 60 C, 1 - 100 %RH)
+ *	Heat_Index			: float rounding only (NOAA regression, no LUT)
+ *	Altitude			: 0.18 m		(300 - 1100 hPa, P0 1013.25 hPa)
+ *
+ *	Out of domain inputs (humidity <= 0, pressure <= 0) return NAN.
+ */
+class Environment_Derived
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	// Humidity Metrics
+	static float Dew_Point(const float Temperature_, const float Humidity_);
+	static float Saturation_Pressure(const float Temperature_);
+	static float Absolute_Humidity(const float Temperature_, const float Humidity_);
+	static float Heat_Index(const float Temperature_, const float Humidity_);
+
+	// Pressure Metrics
+	static float Altitude(const float Pressure_, const float Sea_Level_Pressure_ = ENV_SEA_LEVEL_PRESSURE);
+
+	// LUT Kernels
+	static float Fast_Log2(const float Value_);
+	static float Fast_Exp2(const float Value_);
+
+};
+
+#endif /* defined(__Environment_Derived__) */
@@ -0,0 +1,748 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Sensor Descriptor.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Descriptor.h"
+
+// Define Statistical Library (Statistical average types, optional on Linux hosts)
+#if defined(ENV_PLATFORM_WIRE)
+#define ENV_STATISTICAL
+#elif defined(__has_include)
+#if __has_include(<Statistical.h>)
+#define ENV_STATISTICAL
+#endif
+#endif
+
+#if defined(ENV_STATISTICAL)
+#include <Statistical.h>
+#endif
+
+// Acquisition Functions
+float Environment_Acquisition::Read(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor * Descriptor_P_, const uint8_t Read_Count_, const uint8_t Average_Type_, const Environment_Adaptive * Adaptive_, Environment_Reading * Summary_, const bool Configured_, const uint8_t Retry_, const uint8_t Resolution_) {
+
+	/******************************************************************************
+	 *	Project		: SHT21 and HDC2010 Read Function
+	 *	Developer	: Mehmet Gunce Akkoyun (akkoyun@me.com)
+	 *	Revision	: 05.00.00
+	 *	Release		: 12.10.2020
+	 ******************************************************************************/
+
+	// Read Descriptor From Flash
+	Environment_Descriptor Descriptor_;
+	memcpy_P(&Descriptor_, Descriptor_P_, sizeof(Environment_Descriptor));
+
+	// Declare Output Variable
+	float Value_;
+
+	// Select Resolution (descriptor default unless given)
+	Environment_Resolution Step_;
+	if (!Select(Descriptor_, Resolution_, Step_)) return(-100);
+
+	// Set Resolution Bits on Descriptor Copy
+	if (Descriptor_.Protocol == ENV_PROTOCOL_SHT21) {
+
+		// User Register Resolution
+		Descriptor_.Config_Mask &= ~Descriptor_.Resolution_Mask;
+		Descriptor_.Config = (Descriptor_.Config & ~Descriptor_.Resolution_Mask) | Step_.Set;
+
+	} else {
+
+		// Measurement Register Resolution
+		Descriptor_.Measure_Mask &= ~Descriptor_.Resolution_Mask;
+		Descriptor_.Measure = (Descriptor_.Measure & ~Descriptor_.Resolution_Mask) | Step_.Set;
+
+	}
+
+	// Set Conversion Wait
+	uint32_t Wait_ = Wait(Step_);
+
+	// Start Bus Session (device clock, restored on return)
+	Environment_Bus_Session Session_(Bus_, Device_);
+
+	// ************************************************************
+	// Reset and Configure Sensor
+	// ************************************************************
+
+	// Declare Register Variables
+	uint8_t Config_ = 0x00;
+	uint8_t Measure_ = 0x00;
+
+	// Setup Sensor (soft reset unless device is configured)
+	int16_t Error_ = Setup(Bus_, Device_, Descriptor_, !Configured_, Config_, Measure_);
+
+	// Control For Setup Success
+	if (Error_ != 0) return(Error_);
+
+	// ************************************************************
+	// Read Sensor Data
+	// ************************************************************
+
+	// Fixed Sample Count Unless Adaptive Settings Given
+	Environment_Adaptive Settings_ = {0, 0, 0};
+	if (Adaptive_ != NULL) Settings_ = *Adaptive_;
+
+	// Set Sample Limit (adaptive mode may stop earlier)
+	uint8_t Sample_Limit_ = (Settings_.Target_Error > 0 and Settings_.Max_Count > 0) ? Settings_.Max_Count : Read_Count_;
+	uint8_t Sample_Count_ = 0;
+	uint8_t Failed_Count_ = 0;
+
+	// Define Sequential Estimator
+	Environment_Estimator Estimator_(Settings_, Descriptor_.Calibration_a);
+
+	// Define Measurement Read Arrays (raw codes for built in averages)
+	float Measurement_Array[Sample_Limit_];
+	uint16_t Raw_Array[Sample_Limit_];
+
+	// Read Loop For Read Count
+	for (uint8_t Read_ID = 0; Read_ID < Sample_Limit_; Read_ID++) {
+
+		// Read Raw Sample
+		uint16_t Measurement_Raw = 0;
+		Error_ = Sample(Bus_, Device_, Descriptor_, Config_, Measure_, Wait_, Measurement_Raw);
+
+		// Retry Failed Sample (partial result mode)
+		for (uint8_t Attempt_ = 0; Error_ != 0 and Retry_ != ENV_PARTIAL_OFF and Attempt_ < Retry_; Attempt_++) Error_ = Sample(Bus_, Device_, Descriptor_, Config_, Measure_, Wait_, Measurement_Raw);
+
+		// Control For Read Success
+		if (Error_ != 0) {
+
+			// Any Failed Sample Fails the Read
+			if (Retry_ == ENV_PARTIAL_OFF) return(Error_);
+
+			// Drop Sample
+			Failed_Count_++;
+			continue;
+
+		}
+
+		// Calculate Measurement (failed samples leave no gap)
+		Raw_Array[Sample_Count_] = Measurement_Raw & Descriptor_.Raw_Mask;
+		Measurement_Array[Sample_Count_] = Convert(Descriptor_, Measurement_Raw);
+
+		// Count Sample
+		Sample_Count_++;
+
+		// Stop When Estimate Converged
+		if (Estimator_.Converged(Measurement_Array[Sample_Count_ - 1])) break;
+
+	}
+
+	// Set Failed Sample Count
+	if (Summary_ != NULL) Summary_->Failed = Failed_Count_;
+
+	// Control For Valid Samples (last sample error when every sample failed)
+	if (Sample_Count_ == 0 and Failed_Count_ > 0) return(Error_);
+
+	// Calculate Data
+	if (Average_Type_ >= ENV_AVERAGE_MEAN) {
+
+		// Built In Average on Raw Codes (conversion is linear)
+		Value_ = Descriptor_.Offset + Descriptor_.Scale * Environment_Robust::Estimate(Raw_Array, Sample_Count_, Average_Type_) / 65536;
+
+	} else {
+
+#if defined(ENV_STATISTICAL)
+
+		// Statistical Library Average
+		Statistical DataSet_;
+		DataSet_.Array_Statistic(Measurement_Array, Sample_Count_, Average_Type_);
+
+		// Get Average
+		Value_ = DataSet_.Array_Average;
+
+#else
+
+		// Built In Mean Without Statistical Library (Linux host)
+		Value_ = Descriptor_.Offset + Descriptor_.Scale * Environment_Robust::Estimate(Raw_Array, Sample_Count_, ENV_AVERAGE_MEAN) / 65536;
+
+#endif
+
+	}
+
+	// ************************************************************
+	// Control For Sensor Range
+	// ************************************************************
+	if (Value_ < Descriptor_.Range_Min or Value_ > Descriptor_.Range_Max) return(-106);
+
+	// ************************************************************
+	// Calibrate Data
+	// ************************************************************
+
+	Value_ = (Descriptor_.Calibration_a * Value_) + Descriptor_.Calibration_b;
+
+	// Set Sample Statistics
+	if (Summary_ != NULL) Summary(Measurement_Array, Sample_Count_, Descriptor_.Calibration_a, Descriptor_.Calibration_b, *Summary_);
+
+	// End Function
+	return(Value_);
+
+}
+float Environment_Acquisition::Value(const Environment_Descriptor * Descriptor_P_, const uint8_t * Data_) {
+
+	// Read Descriptor From Flash
+	Environment_Descriptor Descriptor_;
+	memcpy_P(&Descriptor_, Descriptor_P_, sizeof(Environment_Descriptor));
+
+	// Combine Read Bytes (SHT21 MSB first, HDC2010 LSB first)
+	uint16_t Raw_ = (Descriptor_.Protocol == ENV_PROTOCOL_SHT21) ? (((uint16_t)Data_[0] << 8) | Data_[1]) : (((uint16_t)Data_[1] << 8) | Data_[0]);
+
+	// Calculate Measurement
+	float Value_ = Convert(Descriptor_, Raw_);
+
+	// Control For Sensor Range
+	if (Value_ < Descriptor_.Range_Min or Value_ > Descriptor_.Range_Max) return(-106);
+
+	// Calibrate Data
+	return((Descriptor_.Calibration_a * Value_) + Descriptor_.Calibration_b);
+
+}
+int16_t Environment_Acquisition::Pair(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor * Descriptor_P_, const Environment_Descriptor * Pair_P_, const bool Configured_, const uint8_t Resolution_, const uint8_t Pair_Resolution_, float & Value_, float & Pair_Value_) {
+
+	// Read Descriptors From Flash
+	Environment_Descriptor Descriptor_;
+	Environment_Descriptor Pair_;
+	memcpy_P(&Descriptor_, Descriptor_P_, sizeof(Environment_Descriptor));
+	memcpy_P(&Pair_, Pair_P_, sizeof(Environment_Descriptor));
+
+	// Both Values Fail Until Their Frame is Checked
+	Value_ = -100;
+	Pair_Value_ = -100;
+
+	// Control for Protocol (no hold master commands)
+	if (Descriptor_.Protocol != ENV_PROTOCOL_SHT21 or Pair_.Protocol != ENV_PROTOCOL_SHT21) return(-100);
+
+	// Select User Register Settings (a channel without resolution shares the setting of the other)
+	Environment_Resolution Step_;
+	Environment_Resolution Pair_Setting_;
+	bool Found_ = (Resolution_ != ENV_RESOLUTION_DEFAULT or Pair_Resolution_ == ENV_RESOLUTION_DEFAULT) ? Select(Descriptor_, Resolution_, Step_) : Select(Pair_, Pair_Resolution_, Step_);
+	if (!Found_) return(-100);
+	if (Pair_Resolution_ == ENV_RESOLUTION_DEFAULT or Resolution_ == ENV_RESOLUTION_DEFAULT) Pair_Setting_ = Step_;
+	else if (!Select(Pair_, Pair_Resolution_, Pair_Setting_)) return(-100);
+
+	// Set Resolution Bits on Descriptor Copies
+	Descriptor_.Config_Mask &= ~Descriptor_.Resolution_Mask;
+	Descriptor_.Config = (Descriptor_.Config & ~Descriptor_.Resolution_Mask) | Step_.Set;
+	Pair_.Config = (Pair_.Config & ~Pair_.Resolution_Mask) | Pair_Setting_.Set;
+
+	// Get Conversion Times of Setting
+	Environment_Resolution Value_Step_;
+	Environment_Resolution Pair_Step_;
+	if (!Select(Descriptor_, ENV_RESOLUTION_DEFAULT, Value_Step_) or !Select(Pair_, ENV_RESOLUTION_DEFAULT, Pair_Step_)) return(-100);
+
+	// Start Bus Session (device clock, restored on return)
+	Environment_Bus_Session Session_(Bus_, Device_);
+
+	// ************************************************************
+	// Reset and Configure Sensor (once for both channels)
+	// ************************************************************
+
+	// Declare Register Variables
+	uint8_t Config_ = 0x00;
+	uint8_t Measure_ = 0x00;
+
+	// Setup Sensor (soft reset unless device is configured)
+	int16_t Error_ = Setup(Bus_, Device_, Descriptor_, !Configured_, Config_, Measure_);
+
+	// Control For Setup Success
+	if (Error_ != 0) {
+
+		// Set Error
+		Value_ = Error_;
+		Pair_Value_ = Error_;
+
+		// End Function
+		return(Error_);
+
+	}
+
+	// ************************************************************
+	// Read Sensor Data
+	// ************************************************************
+
+	// Declare Frame Variables (MSB, LSB, CRC)
+	uint8_t Value_Data_[3];
+	uint8_t Pair_Data_[3];
+
+	// Trigger First Conversion
+	uint32_t Trigger_ = micros();
+	Error_ = (Bus_.Write_Command(Device_, Descriptor_.Result | ENV_SHT21_NO_HOLD) != 0) ? -103 : 0;
+
+	// Fetch First Result
+	if (Error_ == 0) Error_ = Fetch(Bus_, Device_, Value_Step_, Trigger_, Value_Data_);
+
+	// Control For Read Success
+	if (Error_ != 0) {
+
+		// Set Error
+		Value_ = Error_;
+		Pair_Value_ = Error_;
+
+		// End Function
+		return(Error_);
+
+	}
+
+	// Set Pair Resolution When Settings Differ (device keeps pair setting)
+	if (Pair_Setting_.Set != Step_.Set and Bus_.Write_Register(Device_, 0b11100110, (Config_ & ~Pair_.Resolution_Mask) | Pair_Setting_.Set) != 0) Error_ = -102;
+
+	// Trigger Pair Conversion Right After First Result
+	Trigger_ = micros();
+	if (Error_ == 0) Error_ = (Bus_.Write_Command(Device_, Pair_.Result | ENV_SHT21_NO_HOLD) != 0) ? -103 : 0;
+
+	// Check and Convert First Frame While Pair Converts
+	Value_ = Frame(Descriptor_, Value_Data_);
+
+	// Fetch Pair Result
+	if (Error_ == 0) Error_ = Fetch(Bus_, Device_, Pair_Step_, Trigger_, Pair_Data_);
+
+	// Check and Convert Pair Frame
+	Pair_Value_ = (Error_ != 0) ? Error_ : Frame(Pair_, Pair_Data_);
+
+	// End Function (first failed value)
+	if (Value_ <= ENV_ERROR_LIMIT) return((int16_t)Value_);
+	if (Pair_Value_ <= ENV_ERROR_LIMIT) return((int16_t)Pair_Value_);
+	return(0);
+
+}
+
+// Resolution Functions
+bool Environment_Acquisition::Resolution(const Environment_Descriptor * Descriptor_P_, const uint8_t Resolution_, Environment_Resolution & Step_) {
+
+	// Read Descriptor From Flash
+	Environment_Descriptor Descriptor_;
+	memcpy_P(&Descriptor_, Descriptor_P_, sizeof(Environment_Descriptor));
+
+	// Find Resolution Step
+	return(Select(Descriptor_, Resolution_, Step_));
+
+}
+uint32_t Environment_Acquisition::Latency(const Environment_Descriptor * Descriptor_P_, const uint8_t Resolution_, const uint8_t Read_Count_, const bool Configured_, const uint32_t Clock_) {
+
+	// Read Descriptor From Flash
+	Environment_Descriptor Descriptor_;
+	memcpy_P(&Descriptor_, Descriptor_P_, sizeof(Environment_Descriptor));
+
+	// Find Resolution Step
+	Environment_Resolution Step_;
+	if (!Select(Descriptor_, Resolution_, Step_)) return(0);
+
+	// Declare Time Variables
+	uint32_t Time_ = 0;
+	uint32_t Bytes_ = 0;
+
+	// Calculate Read Time
+	switch (Descriptor_.Protocol) {
+
+		case ENV_PROTOCOL_SHT21:
+
+			// Soft Reset and Clock Stretched Conversions
+			Time_ = (Configured_ ? 0 : (uint32_t)ENV_SHT21_RESET_TIME * 1000) + (uint32_t)Read_Count_ * Step_.Time;
+			Bytes_ = ENV_SHT21_SETUP_BYTES + (uint32_t)Read_Count_ * ENV_SHT21_SAMPLE_BYTES;
+			break;
+
+		case ENV_PROTOCOL_HDC2010:
+
+			// Soft Reset, Config Writes and Conversion Waits
+			Time_ = (Configured_ ? 0 : (uint32_t)(ENV_HDC2010_RESET_TIME + ENV_HDC2010_SETTLE_TIME) * 1000) + (uint32_t)Read_Count_ * (ENV_HDC2010_WRITE_TIME + Wait(Step_)) * 1000;
+			Bytes_ = ENV_HDC2010_SETUP_BYTES + (uint32_t)Read_Count_ * ENV_HDC2010_SAMPLE_BYTES;
+			break;
+
+		default:
+
+			// End Function
+			return(0);
+
+	}
+
+	// Add Bus Transfers (9 clocks per byte)
+	if (Clock_ >= 1000) Time_ += (Bytes_ * 9000) / (Clock_ / 1000);
+
+	// End Function
+	return(Time_);
+
+}
+
+// Deadline Functions
+float Environment_Acquisition::Precision(const Environment_Descriptor * Descriptor_P_, const uint8_t Resolution_, const uint8_t Read_Count_, const float Noise_) {
+
+	// Read Descriptor From Flash
+	Environment_Descriptor Descriptor_;
+	memcpy_P(&Descriptor_, Descriptor_P_, sizeof(Environment_Descriptor));
+
+	// Find Resolution Step
+	Environment_Resolution Step_;
+	if (!Select(Descriptor_, Resolution_, Step_) or Read_Count_ == 0) return(0);
+
+	// Calculate Calibrated Step Size of Resolution
+	float Step_Size_ = fabs(Descriptor_.Calibration_a * Descriptor_.Scale) / (float)((uint32_t)1 << Step_.Bits);
+
+	// Sample Noise With Quantization Noise, Averaged Over Samples
+	return(sqrt((Noise_ * Noise_ + Step_Size_ * Step_Size_ / 12) / Read_Count_));
+
+}
+float Environment_Acquisition::Plan(const Environment_Descriptor * Descriptor_P_, const uint32_t Deadline_, const float Noise_, const bool Configured_, const uint32_t Clock_, uint8_t & Resolution_, uint8_t & Read_Count_) {
+
+	// Read Descriptor From Flash
+	Environment_Descriptor Descriptor_;
+	memcpy_P(&Descriptor_, Descriptor_P_, sizeof(Environment_Descriptor));
+
+	// Nothing Planned
+	float Best_ = 0;
+	Read_Count_ = 0;
+	Resolution_ = ENV_RESOLUTION_DEFAULT;
+
+	// Try Every Resolution (highest first, keeps it on equal precision)
+	for (uint8_t i = 0; i < Descriptor_.Resolution_Count; i++) {
+
+		// Read Step From Flash
+		Environment_Resolution Step_;
+		memcpy_P(&Step_, &Descriptor_.Resolution_P[i], sizeof(Environment_Resolution));
+
+		// Calculate Fixed and Per Sample Time
+		uint32_t Fixed_ = Latency(Descriptor_P_, Step_.Bits, 0, Configured_, Clock_);
+		uint32_t Sample_ = Latency(Descriptor_P_, Step_.Bits, 1, Configured_, Clock_) - Fixed_;
+
+		// Control for Single Sample
+		if (Sample_ == 0 or Fixed_ + Sample_ > Deadline_) continue;
+
+		// Calculate Sample Count Within Deadline
+		uint32_t Count_ = (Deadline_ - Fixed_) / Sample_;
+		if (Count_ > ENV_DEADLINE_MAX_COUNT) Count_ = ENV_DEADLINE_MAX_COUNT;
+
+		// Calculate Precision
+		float Precision_ = Precision(Descriptor_P_, Step_.Bits, (uint8_t)Count_, Noise_);
+
+		// Keep Best Plan
+		if (Read_Count_ == 0 or Precision_ < Best_) {
+
+			// Set Plan
+			Best_ = Precision_;
+			Resolution_ = Step_.Bits;
+			Read_Count_ = (uint8_t)Count_;
+
+		}
+
+	}
+
+	// End Function
+	return(Best_);
+
+}
+
+// Warm Start Functions
+bool Environment_Acquisition::Check(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor * Descriptor_P_) {
+
+	// Read Descriptor From Flash
+	Environment_Descriptor Descriptor_;
+	memcpy_P(&Descriptor_, Descriptor_P_, sizeof(Environment_Descriptor));
+
+	// Start Bus Session
+	Environment_Bus_Session Session_(Bus_, Device_);
+
+	// Read Registers
+	uint8_t Config_ = 0x00;
+	uint8_t Measure_ = 0x00;
+	switch (Descriptor_.Protocol) {
+
+		case ENV_PROTOCOL_SHT21:
+
+			// Read User Register of SHT21
+			if (Bus_.Read_Register(Device_, 0b11100110, &Config_, 1) != 0) return(false);
+
+			// Control for Set Bits
+			return((Config_ & ~Descriptor_.Config_Mask) == (Descriptor_.Config & ~Descriptor_.Config_Mask));
+
+		case ENV_PROTOCOL_HDC2010:
+
+			// Read Config and Measurement Config Registers of HDC2010
+			if (Bus_.Read_Register(Device_, 0x0E, &Config_, 1) != 0) return(false);
+			if (Bus_.Read_Register(Device_, 0x0F, &Measure_, 1) != 0) return(false);
+
+			// Control for Set Bits (measurement trigger bit clears itself)
+			if ((Config_ & ~Descriptor_.Config_Mask) != (Descriptor_.Config & ~Descriptor_.Config_Mask)) return(false);
+			return((Measure_ & ~(Descriptor_.Measure_Mask | 0x01)) == (Descriptor_.Measure & ~(Descriptor_.Measure_Mask | 0x01)));
+
+		default:
+
+			// End Function
+			return(false);
+
+	}
+
+}
+int16_t Environment_Acquisition::Reset(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor * Descriptor_P_) {
+
+	// Read Descriptor From Flash
+	Environment_Descriptor Descriptor_;
+	memcpy_P(&Descriptor_, Descriptor_P_, sizeof(Environment_Descriptor));
+
+	// Start Bus Session
+	Environment_Bus_Session Session_(Bus_, Device_);
+
+	// Declare Register Variables
+	uint8_t Config_ = 0x00;
+	uint8_t Measure_ = 0x00;
+
+	// Reset and Configure Sensor
+	return(Setup(Bus_, Device_, Descriptor_, true, Config_, Measure_));
+
+}
+
+// Private Functions
+int16_t Environment_Acquisition::Setup(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor & Descriptor_, const bool Reset_, uint8_t & Config_, uint8_t & Measure_) {
+
+	// Setup Sensor
+	switch (Descriptor_.Protocol) {
+
+		case ENV_PROTOCOL_SHT21: {
+
+			// Soft Reset (skipped when configuration is known)
+			if (Reset_) {
+
+				// Send Soft Reset Command to SHT21
+				if (Bus_.Write_Command(Device_, 0b11111110) != 0) return(-101);
+
+				// Software Reset Delay
+				Bus_.Delay(ENV_SHT21_RESET_TIME);
+
+			}
+
+			// Read User Register of SHT21 (first transaction of a warm read)
+			uint8_t SHT21_Config_Read = 0x00;
+			if (Bus_.Read_Register(Device_, 0b11100110, &SHT21_Config_Read, 1) != 0 and !Reset_) return(-101);
+
+			// Set User Register
+			Config_ = (SHT21_Config_Read & Descriptor_.Config_Mask) | Descriptor_.Config;
+
+			// Write New Settings if Different
+			if (SHT21_Config_Read != Config_ and Bus_.Write_Register(Device_, 0b11100110, Config_) != 0) return(-102);
+
+			// End Function
+			return(0);
+
+		}
+
+		case ENV_PROTOCOL_HDC2010: {
+
+			// Soft Reset (skipped when configuration is known)
+			if (Reset_) {
+
+				// Read Config Register of HDC2010
+				uint8_t HDC2010_Reset_Read = 0x00;
+				Bus_.Read_Register(Device_, 0x0E, &HDC2010_Reset_Read, 1);
+
+				// Send Soft Reset Bit to HDC2010
+				if (Bus_.Write_Register(Device_, 0x0E, (HDC2010_Reset_Read | 0b10000000)) != 0) return(-101);
+
+				// Software Reset Delay
+				Bus_.Delay(ENV_HDC2010_RESET_TIME);
+
+			}
+
+			// Read Config Register (first transaction of a warm read)
+			if (Bus_.Read_Register(Device_, 0x0E, &Config_, 1) != 0 and !Reset_) return(-101);
+
+			// Register Read Delay (settling after reset)
+			if (Reset_) Bus_.Delay(ENV_HDC2010_SETTLE_TIME);
+
+			// Read Measurement Config Register
+			Bus_.Read_Register(Device_, 0x0F, &Measure_, 1);
+
+			// Set Measurement Rate, Mode, Resolution and Trigger
+			Config_ = (Config_ & Descriptor_.Config_Mask) | Descriptor_.Config;
+			Measure_ = (Measure_ & Descriptor_.Measure_Mask) | Descriptor_.Measure;
+
+			// End Function
+			return(0);
+
+		}
+
+		default:
+
+			// End Function
+			return(-100);
+
+	}
+
+}
+int16_t Environment_Acquisition::Sample(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor & Descriptor_, const uint8_t Config_, const uint8_t Measure_, const uint32_t Wait_, uint16_t & Raw_) {
+
+	// Define Data Variable
+	uint8_t Data_[3];
+
+	// Read Sample
+	switch (Descriptor_.Protocol) {
+
+		case ENV_PROTOCOL_SHT21:
+
+			// Send Read Command to SHT21 and Read I2C Bytes (MSB, LSB, CRC, clock stretched for conversion)
+			if (Bus_.Read_Register(Device_, Descriptor_.Result, Data_, 3) != 0) return(-103);
+
+			// Combine Read Bytes
+			Raw_ = ((uint16_t)Data_[0] << 8) | (uint16_t)Data_[1];
+
+			// End Function
+			return(0);
+
+		case ENV_PROTOCOL_HDC2010:
+
+			// Write Config Register
+			if (Bus_.Write_Register(Device_, 0x0E, Config_) != 0) return(-102);
+
+			// Register Write Delay
+			Bus_.Delay(ENV_HDC2010_WRITE_TIME);
+
+			// Write Measurement Config Register (triggers measurement)
+			if (Bus_.Write_Register(Device_, 0x0F, Measure_) != 0) return(-103);
+
+			// Conversion Wait of Resolution
+			Bus_.Delay(Wait_);
+
+			// Read Result Registers (LSB, MSB)
+			if (Bus_.Read_Register(Device_, Descriptor_.Result, Data_, 2) != 0) return(-104);
+
+			// Combine Read Bytes
+			Raw_ = ((uint16_t)Data_[1] << 8) | (uint16_t)Data_[0];
+
+			// End Function
+			return(0);
+
+		default:
+
+			// End Function
+			return(-100);
+
+	}
+
+}
+bool Environment_Acquisition::Select(const Environment_Descriptor & Descriptor_, const uint8_t Resolution_, Environment_Resolution & Step_) {
+
+	// Default Resolution Bits of Descriptor
+	uint8_t Default_ = ((Descriptor_.Protocol == ENV_PROTOCOL_SHT21) ? Descriptor_.Config : Descriptor_.Measure) & Descriptor_.Resolution_Mask;
+
+	// Search Resolution Table
+	for (uint8_t i = 0; i < Descriptor_.Resolution_Count; i++) {
+
+		// Read Step From Flash
+		memcpy_P(&Step_, &Descriptor_.Resolution_P[i], sizeof(Environment_Resolution));
+
+		// Control for Step
+		if (Resolution_ == ENV_RESOLUTION_DEFAULT and Step_.Set == Default_) return(true);
+		if (Resolution_ != ENV_RESOLUTION_DEFAULT and Step_.Bits == Resolution_) return(true);
+
+	}
+
+	// End Function
+	return(false);
+
+}
+uint32_t Environment_Acquisition::Wait(const Environment_Resolution & Step_) {
+
+	// Conversion Time in Whole ms (rounded up)
+	return((Step_.Time + 999) / 1000);
+
+}
+int16_t Environment_Acquisition::Fetch(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Resolution & Step_, const uint32_t Trigger_, uint8_t * Data_) {
+
+	// Wait Typical Part of Conversion (about 3/4 of maximum, time since trigger counts)
+	uint32_t Typical_ = Step_.Time / 4 * 3;
+	uint32_t Elapsed_ = micros() - Trigger_;
+	if (Elapsed_ < Typical_) Bus_.Delay((Typical_ - Elapsed_ + 999) / 1000);
+
+	// Poll Result (sensor NACKs its address while converting)
+	while (Bus_.Read(Device_, Data_, 3) != 0) {
+
+		// Control for Maximum Conversion Time
+		if ((uint32_t)(micros() - Trigger_) > Step_.Time + (uint32_t)ENV_SHT21_POLL_TIME * 1000) return(-104);
+
+		// Poll Delay
+		Bus_.Delay(ENV_SHT21_POLL_TIME);
+
+	}
+
+	// End Function
+	return(0);
+
+}
+float Environment_Acquisition::Frame(const Environment_Descriptor & Descriptor_, const uint8_t * Data_) {
+
+	// Control for Checksum
+	if (Checksum(Data_, 2) != Data_[2]) return(ENV_ERROR_CRC);
+
+	// Calculate Measurement (MSB first)
+	float Value_ = Convert(Descriptor_, ((uint16_t)Data_[0] << 8) | (uint16_t)Data_[1]);
+
+	// Control For Sensor Range
+	if (Value_ < Descriptor_.Range_Min or Value_ > Descriptor_.Range_Max) return(-106);
+
+	// Calibrate Data
+	return((Descriptor_.Calibration_a * Value_) + Descriptor_.Calibration_b);
+
+}
+uint8_t Environment_Acquisition::Checksum(const uint8_t * Data_, const uint8_t Length_) {
+
+	// Declare CRC Variable
+	uint8_t CRC_ = 0x00;
+
+	// Calculate CRC-8 (MSB first)
+	for (uint8_t i = 0; i < Length_; i++) {
+
+		// Add Byte
+		CRC_ ^= Data_[i];
+
+		// Shift Bits
+		for (uint8_t Bit_ = 0; Bit_ < 8; Bit_++) CRC_ = (CRC_ & 0x80) ? (uint8_t)((CRC_ << 1) ^ ENV_SHT21_CRC_POLYNOMIAL) : (uint8_t)(CRC_ << 1);
+
+	}
+
+	// End Function
+	return(CRC_);
+
+}
+float Environment_Acquisition::Convert(const Environment_Descriptor & Descriptor_, const uint16_t Raw_) {
+
+	// Calculate Measurement (status bits cleared)
+	return(Descriptor_.Offset + Descriptor_.Scale * (float)(Raw_ & Descriptor_.Raw_Mask) / 65536);
+
+}
+void Environment_Acquisition::Summary(const float * Data_, const uint8_t Count_, const float Calibration_a_, const float Calibration_b_, Environment_Reading & Summary_) {
+
+	// Control for Data
+	if (Count_ == 0) return;
+
+	// Declare Variables
+	float Min_ = Data_[0], Max_ = Data_[0], Sum_ = 0, Square_Sum_ = 0;
+
+	// Calculate Sums
+	for (uint8_t i = 0; i < Count_; i++) {
+
+		// Set Limits
+		if (Data_[i] < Min_) Min_ = Data_[i];
+		if (Data_[i] > Max_) Max_ = Data_[i];
+
+		// Sum Offsets to First Sample (keeps float precision)
+		float Offset_ = Data_[i] - Data_[0];
+		Sum_ += Offset_;
+		Square_Sum_ += Offset_ * Offset_;
+
+	}
+
+	// Calculate Variance
+	float Variance_ = (Count_ > 1) ? (Square_Sum_ - Sum_ * Sum_ / Count_) / (Count_ - 1) : 0;
+	if (Variance_ < 0) Variance_ = 0;
+
+	// Set Calibrated Statistics
+	Summary_.Min = Calibration_a_ * ((Calibration_a_ < 0) ? Max_ : Min_) + Calibration_b_;
+	Summary_.Max = Calibration_a_ * ((Calibration_a_ < 0) ? Min_ : Max_) + Calibration_b_;
+	Summary_.Deviation = fabs(Calibration_a_) * sqrt(Variance_);
+	Summary_.Count = Count_;
+
+}
@@ -0,0 +1,146 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Sensor Descriptor.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Descriptor__
+#define __Environment_Descriptor__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// Define Bus Layer
+#include "Environment_Bus.h"
+
+// Define Reading Record
+#include "Environment_Reading.h"
+
+// Define Adaptive Sampling
+#include "Environment_Adaptive.h"
+
+// Define Robust Average Kernels
+#include "Environment_Robust.h"
+
+// Command Sequences
+#define ENV_PROTOCOL_SHT21			0		// Soft reset, user register, hold master measurement command
+#define ENV_PROTOCOL_HDC2010		1		// Soft reset bit, config and measurement registers, result registers
+
+// Protocol Delays (ms)
+#define ENV_SHT21_RESET_TIME		15		// Soft reset
+#define ENV_HDC2010_RESET_TIME		10		// Soft reset
+#define ENV_HDC2010_SETTLE_TIME		5		// Register read after reset
+#define ENV_HDC2010_WRITE_TIME		5		// Config write before trigger
+#define ENV_SHT21_POLL_TIME			1		// Result poll period of a no hold master conversion
+
+// SHT21 No Hold Master Commands (hold master command with this bit)
+#define ENV_SHT21_NO_HOLD			0x10
+
+// SHT21 Result Checksum (CRC-8, x^8 + x^5 + x^4 + 1, initial 0x00)
+#define ENV_SHT21_CRC_POLYNOMIAL	0x31
+
+// Protocol Transfers (bytes with address bytes, worst case)
+#define ENV_SHT21_SETUP_BYTES		9		// Soft reset, user register read and write
+#define ENV_SHT21_SAMPLE_BYTES		6		// Measurement command and result with CRC
+#define ENV_HDC2010_SETUP_BYTES		15		// Config read, soft reset, config and measurement register reads
+#define ENV_HDC2010_SAMPLE_BYTES	11		// Config write, trigger write and result read
+
+// Deadline Read Sample Limit
+#ifndef ENV_DEADLINE_MAX_COUNT
+#define ENV_DEADLINE_MAX_COUNT		16
+#endif
+
+// Deadline Read Reuse Limit (largest age of a reused reading, mS)
+#ifndef ENV_DEADLINE_MAX_AGE
+#define ENV_DEADLINE_MAX_AGE		60000
+#endif
+
+// Default Resolution of a Channel (descriptor register settings)
+#define ENV_RESOLUTION_DEFAULT		0
+
+// Resolution Step (one PROGMEM table per channel, defined by the sensor driver)
+struct Environment_Resolution {
+
+	uint8_t		Bits;			// ADC resolution
+	uint8_t		Set;			// Resolution bits of user register (SHT21) or measurement register (HDC2010)
+	uint32_t	Time;			// Maximum conversion time (uS, datasheet)
+
+};
+
+// Channel Acquisition Descriptor (one PROGMEM object per channel, defined by the sensor driver)
+struct Environment_Descriptor {
+
+	uint8_t		Protocol;		// Command sequence
+	uint8_t		Config_Mask;	// Kept bits of config register (SHT21 user register, HDC2010 0x0E)
+	uint8_t		Config;			// Set bits of config register
+	uint8_t		Measure_Mask;	// Kept bits of measurement register (HDC2010 0x0F)
+	uint8_t		Measure;		// Set bits of measurement register (with trigger bit)
+	uint8_t		Result;			// Measurement command (SHT21) or result register (HDC2010)
+	uint16_t	Raw_Mask;		// Status bits cleared from raw value
+	float		Offset;			// Value = Offset + Scale * Raw / 65536
+	float		Scale;
+	float		Range_Min;		// Valid range before calibration
+	float		Range_Max;
+	float		Calibration_a;	// Calibrated value = a * Value + b
+	float		Calibration_b;
+	uint8_t		Resolution_Mask;	// Resolution bits of user register (SHT21) or measurement register (HDC2010)
+	const Environment_Resolution * Resolution_P;	// Resolution table in flash
+	uint8_t		Resolution_Count;
+
+};
+
+// Descriptor Driven Acquisition Engine (SHT21 and HDC2010)
+class Environment_Acquisition
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	// Blocking Read (optional adaptive settings and sample statistics, configured device skips soft reset, partial mode retries and drops failed samples)
+	static float Read(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor * Descriptor_P_, const uint8_t Read_Count_, const uint8_t Average_Type_, const Environment_Adaptive * Adaptive_ = NULL, Environment_Reading * Summary_ = NULL, const bool Configured_ = false, const uint8_t Retry_ = ENV_PARTIAL_OFF, const uint8_t Resolution_ = ENV_RESOLUTION_DEFAULT);
+
+	// Pipelined Pair Read (SHT21 protocol, one setup, second conversion triggered as soon as the first result is fetched, checked frames, user register rewritten between conversions when resolutions differ)
+	static int16_t Pair(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor * Descriptor_P_, const Environment_Descriptor * Pair_P_, const bool Configured_, const uint8_t Resolution_, const uint8_t Pair_Resolution_, float & Value_, float & Pair_Value_);
+
+	// Resolution Functions (false for a resolution the channel does not have, latency is uS with bus transfers at Clock_, none for 0)
+	static bool Resolution(const Environment_Descriptor * Descriptor_P_, const uint8_t Resolution_, Environment_Resolution & Step_);
+	static uint32_t Latency(const Environment_Descriptor * Descriptor_P_, const uint8_t Resolution_, const uint8_t Read_Count_, const bool Configured_, const uint32_t Clock_ = 0);
+
+	// Deadline Functions (standard error of the mean from channel noise and quantization, plan with no samples when nothing fits)
+	static float Precision(const Environment_Descriptor * Descriptor_P_, const uint8_t Resolution_, const uint8_t Read_Count_, const float Noise_);
+	static float Plan(const Environment_Descriptor * Descriptor_P_, const uint32_t Deadline_, const float Noise_, const bool Configured_, const uint32_t Clock_, uint8_t & Resolution_, uint8_t & Read_Count_);
+
+	// Warm Start Functions (configuration check, soft reset and configuration)
+	static bool Check(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor * Descriptor_P_);
+	static int16_t Reset(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor * Descriptor_P_);
+
+	// Convert Result Bytes of a Single Measurement
+	static float Value(const Environment_Descriptor * Descriptor_P_, const uint8_t * Data_);
+
+private:
+
+	// ************************************************************
+	// Private Functions
+	// ************************************************************
+
+	static int16_t Setup(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor & Descriptor_, const bool Reset_, uint8_t & Config_, uint8_t & Measure_);
+	static int16_t Sample(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Descriptor & Descriptor_, const uint8_t Config_, const uint8_t Measure_, const uint32_t Wait_, uint16_t & Raw_);
+	static bool Select(const Environment_Descriptor & Descriptor_, const uint8_t Resolution_, Environment_Resolution & Step_);
+	static uint32_t Wait(const Environment_Resolution & Step_);
+	static int16_t Fetch(Environment_Bus & Bus_, const Environment_Device & Device_, const Environment_Resolution & Step_, const uint32_t Trigger_, uint8_t * Data_);
+	static float Frame(const Environment_Descriptor & Descriptor_, const uint8_t * Data_);
+	static uint8_t Checksum(const uint8_t * Data_, const uint8_t Length_);
+	static float Convert(const Environment_Descriptor & Descriptor_, const uint16_t Raw_);
+	static void Summary(const float * Data_, const uint8_t Count_, const float Calibration_a_, const float Calibration_b_, Environment_Reading & Summary_);
+
+};
+
+#endif /* defined(__Environment_Descriptor__) */
@@ -0,0 +1,152 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Sensor Driver Base.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Driver.h"
+
+Environment_Driver::Environment_Driver(Environment_Bus & Bus_, const uint8_t Address_, const uint32_t Max_Clock_) {
+
+	// Set I2C Bus
+	Bus = &Bus_;
+
+	// Set Default Device Address (main bus)
+	Device = {Address_, ENV_MUX_NONE, 0, Max_Clock_, 0};
+
+	// Not Started
+	Start = ENV_START_NONE;
+	Configured = false;
+	Start_Time = 0;
+	First_Time = 0;
+
+	// Any Failed Sample Fails the Read
+	Retry = ENV_PARTIAL_OFF;
+
+}
+
+// Configuration Functions
+void Environment_Driver::Set_Address(const uint8_t Address_) {
+
+	// Set Device Address
+	Device.Address = Address_;
+
+}
+void Environment_Driver::Set_Mux(const uint8_t Mux_Address_, const uint8_t Mux_Channel_) {
+
+	// Set Device Multiplexer Channel
+	Device.Mux_Address = Mux_Address_;
+	Device.Mux_Channel = Mux_Channel_;
+
+}
+void Environment_Driver::Set_Max_Clock(const uint32_t Max_Clock_) {
+
+	// Set Device Clock Limit
+	Device.Max_Clock = Max_Clock_;
+
+}
+void Environment_Driver::Set_Partial(const bool Enable_, const uint8_t Retry_) {
+
+	// Set Sample Retries (a retry count of ENV_PARTIAL_OFF would disable the mode)
+	Retry = Enable_ ? ((Retry_ == ENV_PARTIAL_OFF) ? (ENV_PARTIAL_OFF - 1) : Retry_) : ENV_PARTIAL_OFF;
+
+}
+
+// Access Functions
+Environment_Device * Environment_Driver::Get_Device(void) {
+
+	// End Function
+	return(&Device);
+
+}
+
+uint16_t Environment_Driver::Failure_Count(void) {
+
+	// End Function
+	return(Device.Failures);
+
+}
+uint32_t Environment_Driver::Clock(void) {
+
+	// End Function (SCL clock of device transactions)
+	return(Bus->Device_Clock(Device));
+
+}
+
+// Start Functions
+uint8_t Environment_Driver::Start_State(void) {
+
+	// End Function
+	return(Start);
+
+}
+uint32_t Environment_Driver::First_Reading_Time(void) {
+
+	// End Function
+	return(First_Time);
+
+}
+bool Environment_Driver::Is_Configured(void) {
+
+	// End Function (next read skips reset)
+	return(Configured);
+
+}
+
+// Protected Start Functions
+void Environment_Driver::Start_Begin(void) {
+
+	// Set Start Time
+	Start_Time = micros();
+	First_Time = 0;
+
+	// Forget Configuration
+	Start = ENV_START_NONE;
+	Configured = false;
+
+}
+bool Environment_Driver::Start_End(const uint8_t Start_) {
+
+	// Set Start State
+	Start = Start_;
+	Configured = (Start_ != ENV_START_NONE);
+
+	// End Function
+	return(Configured);
+
+}
+float Environment_Driver::Result(const float Value_) {
+
+	// Failed Read Needs Full Reset and Configuration
+	if (Value_ <= ENV_ERROR_LIMIT) {
+
+		// Clear Configuration
+		Configured = false;
+
+		// End Function
+		return(Value_);
+
+	}
+
+	// Successful Read Leaves Device Configured
+	if (Start != ENV_START_NONE) Configured = true;
+
+	// Set First Reading Time (never 0 once set)
+	if (Start != ENV_START_NONE and First_Time == 0) {
+
+		// Set Time
+		First_Time = micros() - Start_Time;
+		if (First_Time == 0) First_Time = 1;
+
+	}
+
+	// End Function
+	return(Value_);
+
+}
@@ -0,0 +1,88 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Sensor Driver Base.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Driver__
+#define __Environment_Driver__
+
+// Define Bus Layer
+#include "Environment_Bus.h"
+
+// Define Reading Record
+#include "Environment_Reading.h"
+
+// Driver Start State
+#define ENV_START_NONE				0		// Begin not called or failed, every read resets and configures
+#define ENV_START_COLD				1		// Device reset and configured by Begin
+#define ENV_START_WARM				2		// Configuration found intact by Begin, reset skipped
+
+// Common Driver Part (bus and device address, no virtual functions)
+class Environment_Driver
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Driver(Environment_Bus & Bus_, const uint8_t Address_, const uint32_t Max_Clock_);
+
+	// Device Configuration
+	void Set_Address(const uint8_t Address_);
+	void Set_Mux(const uint8_t Mux_Address_, const uint8_t Mux_Channel_);
+	void Set_Max_Clock(const uint32_t Max_Clock_);
+
+	// Partial Result Mode (descriptor driven sample loop only)
+	void Set_Partial(const bool Enable_, const uint8_t Retry_ = ENV_SAMPLE_RETRY);
+
+	// Device Access
+	Environment_Device * Get_Device(void);
+	uint16_t Failure_Count(void);
+	uint32_t Clock(void);
+
+	// Start Status (time is uS from Begin to end of first valid reading, 0 until then)
+	uint8_t Start_State(void);
+	uint32_t First_Reading_Time(void);
+	bool Is_Configured(void);
+
+protected:
+
+	// ************************************************************
+	// Driver Variables
+	// ************************************************************
+
+	// I2C Bus
+	Environment_Bus * Bus;
+
+	// Device Address
+	Environment_Device Device;
+
+	// Start Variables (Configured is cleared by any failed read)
+	uint8_t Start;
+	bool Configured;
+	uint32_t Start_Time;
+	uint32_t First_Time;
+
+	// Sample Retries or ENV_PARTIAL_OFF
+	uint8_t Retry;
+
+	// ************************************************************
+	// Protected Functions
+	// ************************************************************
+
+	// Start Functions
+	void Start_Begin(void);
+	bool Start_End(const uint8_t Start_);
+	float Result(const float Value_);
+
+};
+
+#endif /* defined(__Environment_Driver__) */
@@ -0,0 +1,82 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - EEPROM Storage.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_EEPROM.h"
+
+#if defined(ENV_PLATFORM_WIRE)
+
+// Define EEPROM Library
+#include <EEPROM.h>
+
+Environment_EEPROM::Environment_EEPROM(const uint16_t Start_, const uint16_t Length_, const uint16_t Page_Size_) {
+
+	// Set Region
+	Start = Start_;
+	Length = Length_;
+	Page_Length = Page_Size_;
+
+}
+
+// Geometry Functions
+uint16_t Environment_EEPROM::Page_Count(void) {
+
+	// Control for Page Size
+	if (Page_Length == 0 or Start >= EEPROM.length()) return(0);
+
+	// Get Region Length (up to end of EEPROM)
+	uint16_t Length_ = EEPROM.length() - Start;
+	if (Length != 0 and Length < Length_) Length_ = Length;
+
+	// End Function
+	return(Length_ / Page_Length);
+
+}
+uint16_t Environment_EEPROM::Page_Size(void) {
+
+	// End Function
+	return(Page_Length);
+
+}
+
+// Page Functions
+bool Environment_EEPROM::Read(const uint16_t Page_, const uint16_t Offset_, uint8_t * Data_, const uint16_t Length_) {
+
+	// Control for Region
+	if (Page_ >= Page_Count() or Offset_ + Length_ > Page_Length) return(false);
+
+	// Get Address
+	uint16_t Address_ = Start + Page_ * Page_Length + Offset_;
+
+	// Read Bytes
+	for (uint16_t i = 0; i < Length_; i++) Data_[i] = EEPROM.read(Address_ + i);
+
+	// End Function
+	return(true);
+
+}
+bool Environment_EEPROM::Write(const uint16_t Page_, const uint8_t * Data_) {
+
+	// Control for Region
+	if (Page_ >= Page_Count()) return(false);
+
+	// Get Address
+	uint16_t Address_ = Start + Page_ * Page_Length;
+
+	// Update Bytes (unchanged cells are not erased)
+	for (uint16_t i = 0; i < Page_Length; i++) EEPROM.update(Address_ + i, Data_[i]);
+
+	// End Function
+	return(true);
+
+}
+
+#endif /* defined(ENV_PLATFORM_WIRE) */
@@ -0,0 +1,57 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - EEPROM Storage.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_EEPROM__
+#define __Environment_EEPROM__
+
+// Define Storage Interface
+#include "Environment_Storage.h"
+
+#if defined(ENV_PLATFORM_WIRE)
+
+// Default Page Size (bytes)
+#define ENV_EEPROM_PAGE_SIZE		64
+
+class Environment_EEPROM : public Environment_Storage
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	// Region From Start Address (Length_ 0 is up to end of EEPROM)
+	Environment_EEPROM(const uint16_t Start_ = 0, const uint16_t Length_ = 0, const uint16_t Page_Size_ = ENV_EEPROM_PAGE_SIZE);
+
+	// Region Geometry
+	uint16_t Page_Count(void);
+	uint16_t Page_Size(void);
+
+	// Page Functions (only changed bytes are written)
+	bool Read(const uint16_t Page_, const uint16_t Offset_, uint8_t * Data_, const uint16_t Length_);
+	bool Write(const uint16_t Page_, const uint8_t * Data_);
+
+private:
+
+	// ************************************************************
+	// Region Variables
+	// ************************************************************
+
+	uint16_t Start;
+	uint16_t Length;
+	uint16_t Page_Length;
+
+};
+
+#endif /* defined(ENV_PLATFORM_WIRE) */
+
+#endif /* defined(__Environment_EEPROM__) */
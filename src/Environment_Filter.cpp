@@ -0,0 +1,141 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Recursive Filter.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Filter.h"
+
+Environment_Filter::Environment_Filter(void) {
+
+	// Filter Disabled by Default
+	Filter_Type = ENV_FILTER_NONE;
+	Parameter_1 = 0;
+	Parameter_2 = 0;
+
+	// Clear State
+	Reset();
+
+}
+
+// Configuration Functions
+void Environment_Filter::Set_EMA(const float Alpha_) {
+
+	// Set Filter
+	Filter_Type = ENV_FILTER_EMA;
+
+	// Limit Alpha (0 - 1], 1 passes measurement unchanged
+	Parameter_1 = (Alpha_ <= 0 or Alpha_ > 1) ? 1 : Alpha_;
+
+	// Clear State
+	Reset();
+
+}
+void Environment_Filter::Set_Kalman(const float Process_Noise_, const float Measurement_Noise_) {
+
+	// Set Filter
+	Filter_Type = ENV_FILTER_KALMAN;
+
+	// Set Noise Variances
+	Parameter_1 = Process_Noise_;
+	Parameter_2 = Measurement_Noise_;
+
+	// Clear State
+	Reset();
+
+}
+void Environment_Filter::Disable(void) {
+
+	// Set Filter
+	Filter_Type = ENV_FILTER_NONE;
+
+	// Clear State
+	Reset();
+
+}
+void Environment_Filter::Reset(void) {
+
+	// Next Measurement Starts Filter
+	Initialized = false;
+	State = 0;
+	Error_Variance = 0;
+
+}
+
+// Filter Functions
+float Environment_Filter::Update(const float Measurement_, const uint8_t Count_, const float Quantization_) {
+
+	// Measurement Variance of Reading (averaged samples)
+	float Variance_ = (Parameter_2 + Quantization_) / ((Count_ == 0) ? 1 : Count_);
+
+	// Control for First Measurement (filter starts at measurement)
+	if (!Initialized) {
+
+		// Set State
+		State = Measurement_;
+		Error_Variance = Variance_;
+		Initialized = true;
+
+		// End Function
+		return(State);
+
+	}
+
+	// Filter Measurement
+	switch (Filter_Type) {
+
+		case ENV_FILTER_EMA:
+
+			// S = S + a * (M - S)
+			State += Parameter_1 * (Measurement_ - State);
+			break;
+
+		case ENV_FILTER_KALMAN: {
+
+			// Predict (random walk, P = P + Q)
+			float Prior_ = Error_Variance + Parameter_1;
+
+			// Update (K = P / (P + R))
+			float Gain_ = (Prior_ + Variance_ > 0) ? Prior_ / (Prior_ + Variance_) : 1;
+			State += Gain_ * (Measurement_ - State);
+			Error_Variance = (1 - Gain_) * Prior_;
+			break;
+
+		}
+
+		default:
+
+			// Pass Measurement
+			State = Measurement_;
+			break;
+
+	}
+
+	// End Function
+	return(State);
+
+}
+float Environment_Filter::Value(void) {
+
+	// End Function
+	return(State);
+
+}
+float Environment_Filter::Variance(void) {
+
+	// End Function
+	return(Error_Variance);
+
+}
+uint8_t Environment_Filter::Type(void) {
+
+	// End Function
+	return(Filter_Type);
+
+}
@@ -0,0 +1,66 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Recursive Filter.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Filter__
+#define __Environment_Filter__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// Filter Types
+#define ENV_FILTER_NONE				0		// Value passes unchanged
+#define ENV_FILTER_EMA				1		// Exponential moving average
+#define ENV_FILTER_KALMAN			2		// Scalar Kalman filter (random walk model)
+
+class Environment_Filter
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Filter(void);
+
+	// Filter Configuration
+	void Set_EMA(const float Alpha_);
+	void Set_Kalman(const float Process_Noise_, const float Measurement_Noise_);
+	void Disable(void);
+	void Reset(void);
+
+	// Filter Functions (Kalman R is the single sample variance, scaled to a reading of Count_ averaged samples with Quantization_ variance)
+	float Update(const float Measurement_, const uint8_t Count_ = 1, const float Quantization_ = 0);
+	float Value(void);
+	float Variance(void);
+	uint8_t Type(void);
+
+private:
+
+	// ************************************************************
+	// Filter Variables
+	// ************************************************************
+
+	// Filter Type
+	uint8_t Filter_Type;
+	bool Initialized;
+
+	// Parameters (EMA: Alpha, Kalman: Q and R)
+	float Parameter_1;
+	float Parameter_2;
+
+	// Filter State
+	float State;
+	float Error_Variance;
+
+};
+
+#endif /* defined(__Environment_Filter__) */
@@ -0,0 +1,84 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - HDC2010 Driver.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_HDC2010.h"
+
+// HDC2010 Temperature Resolutions: measurement register TRES bits, conversion time
+const Environment_Resolution ENV_HDC2010_T_RESOLUTION[] PROGMEM = {
+	{14, 0x00, 610},
+	{11, 0x40, 350},
+	{9, 0x80, 225}
+};
+
+// HDC2010 Humidity Resolutions: measurement register HRES bits, conversion time (with 14 bit temperature)
+const Environment_Resolution ENV_HDC2010_H_RESOLUTION[] PROGMEM = {
+	{14, 0x00, 1270},
+	{11, 0x10, 1010},
+	{9, 0x20, 885}
+};
+
+// HDC2010 Temperature: manual mode, 9 bit, temperature only, result 0x00
+const Environment_Descriptor ENV_HDC2010_T_DESCRIPTOR PROGMEM = {ENV_PROTOCOL_HDC2010, 0x8F, 0x00, 0xAC, 0xA3, 0x00, 0xFFFF, -40, 165, -40, 125, 1.0053, -0.4102, 0xC0, ENV_HDC2010_T_RESOLUTION, 3};
+
+// HDC2010 Humidity: 1 Hz auto mode, 14 bit, temperature and humidity, result 0x02
+const Environment_Descriptor ENV_HDC2010_H_DESCRIPTOR PROGMEM = {ENV_PROTOCOL_HDC2010, 0x8F, 0x50, 0x0D, 0x05, 0x02, 0xFFFF, 0, 100, 0, 100, 0.9821, -0.3217, 0x30, ENV_HDC2010_H_RESOLUTION, 3};
+
+Environment_HDC2010::Environment_HDC2010(Environment_Bus & Bus_, const uint8_t Address_) : Environment_Driver(Bus_, Address_, ENV_HDC2010_MAX_CLOCK) {
+
+}
+
+// Start Functions
+bool Environment_HDC2010::Begin(void) {
+
+	// Set Start Time
+	Start_Begin();
+
+	// Control for Intact Configuration (either channel)
+	if (Environment_Acquisition::Check(*Bus, Device, &ENV_HDC2010_T_DESCRIPTOR) or Environment_Acquisition::Check(*Bus, Device, &ENV_HDC2010_H_DESCRIPTOR)) return(Start_End(ENV_START_WARM));
+
+	// Soft Reset and Configure
+	if (Environment_Acquisition::Reset(*Bus, Device, &ENV_HDC2010_T_DESCRIPTOR) != 0) return(Start_End(ENV_START_NONE));
+
+	// End Function
+	return(Start_End(ENV_START_COLD));
+
+}
+
+// Measurement Functions
+float Environment_HDC2010::Temperature(const uint8_t Read_Count_, const uint8_t Average_Type_, const Environment_Adaptive * Adaptive_, Environment_Reading * Summary_, const uint8_t Resolution_) {
+
+	// Read Channel
+	return(Result(Environment_Acquisition::Read(*Bus, Device, &ENV_HDC2010_T_DESCRIPTOR, Read_Count_, Average_Type_, Adaptive_, Summary_, Configured, Retry, Resolution_)));
+
+}
+float Environment_HDC2010::Humidity(const uint8_t Read_Count_, const uint8_t Average_Type_, const Environment_Adaptive * Adaptive_, Environment_Reading * Summary_, const uint8_t Resolution_) {
+
+	// Read Channel
+	return(Result(Environment_Acquisition::Read(*Bus, Device, &ENV_HDC2010_H_DESCRIPTOR, Read_Count_, Average_Type_, Adaptive_, Summary_, Configured, Retry, Resolution_)));
+
+}
+
+// Power Functions
+uint8_t Environment_HDC2010::Power_Down(void) {
+
+	// Start Bus Session
+	Environment_Bus_Session Session_(*Bus, Device);
+
+	// Read Config Register
+	uint8_t HDC2010_Config_Read = 0x00;
+	uint8_t Result_ = Bus->Read_Register(Device, 0x0E, &HDC2010_Config_Read, 1);
+	if (Result_ != ENV_BUS_OK) return(Result_);
+
+	// Clear Auto Measurement Mode (manual mode sleeps after conversion)
+	return(Bus->Write_Register(Device, 0x0E, HDC2010_Config_Read & 0x8F));
+
+}
@@ -0,0 +1,53 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - HDC2010 Driver.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_HDC2010__
+#define __Environment_HDC2010__
+
+// Define Driver Base
+#include "Environment_Driver.h"
+
+// Define Acquisition Engine
+#include "Environment_Descriptor.h"
+
+// Device Address and Clock
+#define ENV_HDC2010_ADDRESS			0x40	// ADDR pin low
+#define ENV_HDC2010_ADDRESS_ALT		0x41	// ADDR pin high
+#define ENV_HDC2010_MAX_CLOCK		400000
+
+// Channel Descriptors
+extern const Environment_Descriptor ENV_HDC2010_T_DESCRIPTOR PROGMEM;
+extern const Environment_Descriptor ENV_HDC2010_H_DESCRIPTOR PROGMEM;
+
+class Environment_HDC2010 : public Environment_Driver
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_HDC2010(Environment_Bus & Bus_, const uint8_t Address_ = ENV_HDC2010_ADDRESS);
+
+	// Warm Start (skips reset when configuration is intact)
+	bool Begin(void);
+
+	// Measurements (optional adaptive settings, sample statistics and resolution bits)
+	float Temperature(const uint8_t Read_Count_ = 1, const uint8_t Average_Type_ = 1, const Environment_Adaptive * Adaptive_ = NULL, Environment_Reading * Summary_ = NULL, const uint8_t Resolution_ = ENV_RESOLUTION_DEFAULT);
+	float Humidity(const uint8_t Read_Count_ = 1, const uint8_t Average_Type_ = 1, const Environment_Adaptive * Adaptive_ = NULL, Environment_Reading * Summary_ = NULL, const uint8_t Resolution_ = ENV_RESOLUTION_DEFAULT);
+
+	// Power Management
+	uint8_t Power_Down(void);
+
+};
+
+#endif /* defined(__Environment_HDC2010__) */
@@ -0,0 +1,217 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Linux i2c-dev Transport.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Linux.h"
+
+#if defined(ENV_PLATFORM_LINUX)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+// System ioctl
+static int Linux_Ioctl(int File_, unsigned long Request_, void * Argument_) {
+
+	// Call Kernel
+	return(ioctl(File_, Request_, Argument_));
+
+}
+
+Environment_Linux::Environment_Linux(const char * Path_) {
+
+	// Set Adapter
+	Path = Path_;
+	File = -1;
+	Owned = true;
+
+	// Set System ioctl
+	Ioctl_Function = Linux_Ioctl;
+
+	// Clear Counter
+	Transfers = 0;
+
+	// Kernel Default Timeout
+	Timeout = 0;
+
+}
+Environment_Linux::Environment_Linux(const int File_, Environment_Ioctl Ioctl_) {
+
+	// Set Adapter
+	Path = NULL;
+	File = File_;
+	Owned = false;
+
+	// Set ioctl Function
+	Ioctl_Function = (Ioctl_ != NULL) ? Ioctl_ : Linux_Ioctl;
+
+	// Clear Counter
+	Transfers = 0;
+
+	// Kernel Default Timeout
+	Timeout = 0;
+
+}
+Environment_Linux::~Environment_Linux(void) {
+
+	// Close Adapter
+	Close();
+
+}
+
+// Adapter Functions
+bool Environment_Linux::Open(void) {
+
+	// Control for Open Adapter
+	if (File >= 0) return(true);
+
+	// Control for Path
+	if (Path == NULL) return(false);
+
+	// Open Adapter
+	File = open(Path, O_RDWR | O_CLOEXEC);
+
+	// Control for Open
+	if (File < 0) return(false);
+
+	// Set Adapter Timeout
+	if (Timeout != 0) Set_Timeout(Timeout);
+
+	// End Function
+	return(true);
+
+}
+void Environment_Linux::Close(void) {
+
+	// Close Owned Adapter
+	if (Owned and File >= 0) close(File);
+
+	// Forget Descriptor
+	if (Owned) File = -1;
+
+}
+void Environment_Linux::Set_Ioctl(Environment_Ioctl Ioctl_) {
+
+	// Set ioctl Function
+	Ioctl_Function = (Ioctl_ != NULL) ? Ioctl_ : Linux_Ioctl;
+
+}
+uint32_t Environment_Linux::Transfer_Count(void) {
+
+	// End Function
+	return(Transfers);
+
+}
+
+// Transaction Functions
+uint8_t Environment_Linux::Write(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_) {
+
+	// Set Message
+	struct i2c_msg Message_[1] = {
+		{Address_, 0, Length_, (__u8 *)Data_}
+	};
+
+	// Transfer
+	return(Transfer(Message_, 1));
+
+}
+uint8_t Environment_Linux::Read(const uint8_t Address_, uint8_t * Data_, const uint8_t Length_) {
+
+	// Set Message
+	struct i2c_msg Message_[1] = {
+		{Address_, I2C_M_RD, Length_, Data_}
+	};
+
+	// Transfer
+	return(Transfer(Message_, 1));
+
+}
+uint8_t Environment_Linux::Write_Read(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_, uint8_t * Read_Data_, const uint8_t Read_Length_) {
+
+	// Set Messages (repeated start between write and read)
+	struct i2c_msg Message_[2] = {
+		{Address_, 0, Length_, (__u8 *)Data_},
+		{Address_, I2C_M_RD, Read_Length_, Read_Data_}
+	};
+
+	// Transfer
+	return(Transfer(Message_, 2));
+
+}
+void Environment_Linux::Set_Clock(const uint32_t Clock_) {
+
+	// Adapter Clock is Set by Device Tree (nothing to do)
+	(void)Clock_;
+
+}
+
+// Timeout and Recovery Functions
+bool Environment_Linux::Set_Timeout(const uint32_t Timeout_) {
+
+	// Set Timeout
+	Timeout = Timeout_;
+
+	// Control for Open Adapter (set on open otherwise)
+	if (File < 0 or Timeout_ == 0) return(true);
+
+	// Set Adapter Timeout (10 mS steps, rounded up)
+	unsigned long Steps_ = (Timeout_ + 9999) / 10000;
+
+	// End Function
+	return(Ioctl_Function(File, I2C_TIMEOUT, (void *)Steps_) >= 0);
+
+}
+uint8_t Environment_Linux::Recover(void) {
+
+	// Reopen Owned Adapter (kernel bus driver clocks out a held SDA on timeout)
+	Close();
+
+	// End Function
+	return(Open() ? ENV_TRANSPORT_OK : ENV_TRANSPORT_ERROR);
+
+}
+
+// Private Functions
+uint8_t Environment_Linux::Transfer(void * Messages_, const uint8_t Count_) {
+
+	// Open Adapter
+	if (!Open()) return(ENV_TRANSPORT_ERROR);
+
+	// Set Transfer
+	struct i2c_rdwr_ioctl_data Transfer_ = {(struct i2c_msg *)Messages_, Count_};
+
+	// Count Transfer
+	Transfers++;
+
+	// Run Combined Transfer
+	int Result_ = Ioctl_Function(File, I2C_RDWR, &Transfer_);
+
+	// Control for Address NACK
+	if (Result_ < 0 and errno == ENXIO) return(ENV_TRANSPORT_NACK_ADDRESS);
+
+	// Control for NACK (adapters give EREMOTEIO for any NACK, a single read can only NACK its address)
+	if (Result_ < 0 and errno == EREMOTEIO) return((Count_ == 1 and (((struct i2c_msg *)Messages_)[0].flags & I2C_M_RD)) ? ENV_TRANSPORT_NACK_ADDRESS : ENV_TRANSPORT_NACK_DATA);
+
+	// Control for Timeout
+	if (Result_ < 0 and errno == ETIMEDOUT) return(ENV_TRANSPORT_TIMEOUT);
+
+	// Control for Transfer
+	if (Result_ != Count_) return(ENV_TRANSPORT_ERROR);
+
+	// End Function
+	return(ENV_TRANSPORT_OK);
+
+}
+
+#endif /* defined(ENV_PLATFORM_LINUX) */
@@ -0,0 +1,88 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Linux i2c-dev Transport.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Linux__
+#define __Environment_Linux__
+
+// Define Transport Interface
+#include "Environment_Transport.h"
+
+#if defined(ENV_PLATFORM_LINUX)
+
+// Default I2C Adapter
+#define ENV_LINUX_DEFAULT_DEVICE	"/dev/i2c-1"
+
+// ioctl Function (replaceable with a fake for tests)
+typedef int (*Environment_Ioctl)(int File_, unsigned long Request_, void * Argument_);
+
+class Environment_Linux : public Environment_Transport
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	// Adapter Device (opened on first transaction)
+	Environment_Linux(const char * Path_);
+
+	// Open File Descriptor (not closed by transport)
+	Environment_Linux(const int File_, Environment_Ioctl Ioctl_ = NULL);
+
+	~Environment_Linux(void);
+
+	// Adapter Functions
+	bool Open(void);
+	void Close(void);
+	void Set_Ioctl(Environment_Ioctl Ioctl_);
+	uint32_t Transfer_Count(void);
+
+	// Transactions (one I2C_RDWR ioctl each)
+	uint8_t Write(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_);
+	uint8_t Read(const uint8_t Address_, uint8_t * Data_, const uint8_t Length_);
+	uint8_t Write_Read(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_, uint8_t * Read_Data_, const uint8_t Read_Length_);
+	void Set_Clock(const uint32_t Clock_);
+
+	// Timeout and Recovery (adapter timeout in 10 mS steps, kernel bus driver does the line recovery)
+	bool Set_Timeout(const uint32_t Timeout_);
+	uint8_t Recover(void);
+
+private:
+
+	// ************************************************************
+	// Adapter Variables
+	// ************************************************************
+
+	// Adapter
+	const char * Path;
+	int File;
+	bool Owned;
+
+	// ioctl Function
+	Environment_Ioctl Ioctl_Function;
+
+	// Transfer Counter
+	uint32_t Transfers;
+
+	// Adapter Timeout (uS, 0 = kernel default)
+	uint32_t Timeout;
+
+	// Combined Transfer
+	uint8_t Transfer(void * Messages_, const uint8_t Count_);
+
+};
+
+extern Environment_Linux Environment_Linux_Port;
+
+#endif /* defined(ENV_PLATFORM_LINUX) */
+
+#endif /* defined(__Environment_Linux__) */
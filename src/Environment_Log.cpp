@@ -0,0 +1,483 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Reading Log.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Log.h"
+
+// No Checked Page (sequence never reached)
+#define ENV_LOG_NONE				0xFFFFFFFF
+
+// CRC Chunk Size (bytes read from storage at once)
+#define ENV_LOG_CHUNK				16
+
+Environment_Log::Environment_Log(Environment_Storage & Storage_) {
+
+	// Set Storage
+	Storage = &Storage_;
+
+	// Not Mounted
+	Pages = 0;
+	Page_Length = 0;
+	Page_Records = 0;
+	Mounted = false;
+
+	// Clear State
+	Head = 0;
+	Page_Fill = 0;
+	Dirty = false;
+	Tail = 0;
+	Tail_Index = 0;
+	Cursor = 0;
+	Cursor_Index = 0;
+	Checked = ENV_LOG_NONE;
+	Checked_Count = 0;
+	Lost = 0;
+
+}
+
+// Log Functions
+bool Environment_Log::Begin(void) {
+
+	// Get Geometry
+	Pages = Storage->Page_Count();
+	Page_Length = Storage->Page_Size();
+
+	// Control for Geometry (page must fit buffer and hold a record, two pages at least)
+	if (Pages < 2 or Page_Length > ENV_LOG_PAGE_SIZE or Page_Length < ENV_LOG_HEADER_SIZE + ENV_LOG_RECORD_SIZE) return(false);
+
+	// Set Records per Page
+	uint16_t Records_ = (Page_Length - ENV_LOG_HEADER_SIZE) / ENV_LOG_RECORD_SIZE;
+	Page_Records = (Records_ > 255) ? 255 : (uint8_t)Records_;
+
+	// Declare Newest Page Variables
+	uint32_t Newest_ = 0;
+	uint8_t Newest_Count_ = 0;
+	bool Found_ = false;
+
+	// Find Newest Valid Page
+	for (uint16_t i = 0; i < Pages; i++) {
+
+		// Read Sequence
+		uint8_t Header_[4];
+		if (!Storage->Read(i, 0, Header_, 4)) continue;
+		uint32_t Sequence_ = Get_Long(Header_);
+
+		// Control for Page Position and Age
+		if (Sequence_ == ENV_LOG_NONE or Sequence_ % Pages != i) continue;
+		if (Found_ and Sequence_ <= Newest_) continue;
+
+		// Control for Page Check
+		uint8_t Count_;
+		if (!Check_Page(Sequence_, Count_)) continue;
+
+		// Set Newest Page
+		Newest_ = Sequence_;
+		Newest_Count_ = Count_;
+		Found_ = true;
+
+	}
+
+	// Clear Page Buffer
+	memset(Page, 0, sizeof(Page));
+
+	// Empty Region
+	if (!Found_) {
+
+		// Start at First Page
+		Head = 0;
+		Page_Fill = 0;
+		Tail = 0;
+		Tail_Index = 0;
+
+	} else {
+
+		// Load Newest Page
+		if (!Storage->Read(Newest_ % Pages, 0, Page, ENV_LOG_HEADER_SIZE + Newest_Count_ * ENV_LOG_RECORD_SIZE)) return(false);
+
+		// Set Head and Tail
+		Head = Newest_;
+		Page_Fill = Newest_Count_;
+		Tail = Get_Long(&Page[4]);
+		Tail_Index = Page[8];
+
+		// Control for Tail Beyond Head (drop all)
+		if (Tail > Head or (Tail == Head and Tail_Index > Page_Fill)) {
+
+			// Set Tail to Head
+			Tail = Head;
+			Tail_Index = Page_Fill;
+
+		}
+
+		// Full Page Continues on Next Page
+		if (Page_Fill == Page_Records) {
+
+			// Set Next Page
+			Head++;
+			Page_Fill = 0;
+			memset(Page, 0, sizeof(Page));
+
+		}
+
+	}
+
+	// Clear State
+	Dirty = false;
+	Lost = 0;
+	Mounted = true;
+
+	// Drop Pages Beyond Region
+	Trim();
+
+	// Set Cursor to Tail
+	Rewind();
+
+	// End Function
+	return(true);
+
+}
+bool Environment_Log::Clear(void) {
+
+	// Control for Mount
+	if (!Mounted and !Begin()) return(false);
+
+	// Set Tail and Cursor to Head
+	Tail = Head;
+	Tail_Index = Page_Fill;
+	Rewind();
+
+	// Store Tail
+	Dirty = true;
+
+	// End Function
+	return(Flush());
+
+}
+
+// Write Functions
+bool Environment_Log::Append(const uint8_t Channel_, const float Value_, const uint32_t Time_) {
+
+	// Control for Mount
+	if (!Mounted and !Begin()) return(false);
+
+	// Control for Full Page (previous page write failed)
+	if (Page_Fill == Page_Records and !Advance()) return(false);
+
+	// Set Record
+	uint8_t * Record_ = &Page[ENV_LOG_HEADER_SIZE + Page_Fill * ENV_LOG_RECORD_SIZE];
+	Put_Long(Record_, Time_);
+	Record_[4] = Channel_;
+	memcpy(&Record_[5], &Value_, 4);
+
+	// Count Record
+	Page_Fill++;
+	Dirty = true;
+
+	// Write Full Page (a failed write is retried on next append)
+	if (Page_Fill == Page_Records) Advance();
+
+	// End Function
+	return(true);
+
+}
+bool Environment_Log::Append(const uint8_t Channel_, const Environment_Reading & Reading_) {
+
+	// Append Reading (value holds error code on error)
+	return(Append(Channel_, Reading_.Value, Reading_.Time));
+
+}
+bool Environment_Log::Flush(void) {
+
+	// Control for Mount
+	if (!Mounted) return(false);
+
+	// Write Head Page
+	if (Dirty and !Write_Page()) return(false);
+
+	// Sync Storage
+	return(Storage->Sync());
+
+}
+
+// Read Functions
+bool Environment_Log::Read(Environment_Record & Record_) {
+
+	// Control for Mount
+	if (!Mounted) return(false);
+
+	// Find Next Record
+	while (true) {
+
+		// Control for End of Log
+		if (Cursor > Head or (Cursor == Head and Cursor_Index >= Page_Fill)) return(false);
+
+		// Declare Record Buffer
+		uint8_t Data_[ENV_LOG_RECORD_SIZE];
+
+		// Head Page Record (RAM)
+		if (Cursor == Head) {
+
+			// Copy Record
+			memcpy(Data_, &Page[ENV_LOG_HEADER_SIZE + Cursor_Index * ENV_LOG_RECORD_SIZE], ENV_LOG_RECORD_SIZE);
+
+		} else {
+
+			// Check Page Once When Cursor Enters It
+			if (Checked != Cursor) {
+
+				// Control for Page (damaged page is skipped)
+				if (!Check_Page(Cursor, Checked_Count)) Checked_Count = 0;
+				Checked = Cursor;
+
+			}
+
+			// Control for End of Page
+			if (Cursor_Index >= Checked_Count) {
+
+				// Count Skipped Records
+				if (Cursor_Index < Page_Records) Lost += Page_Records - Cursor_Index;
+
+				// Set Next Page
+				Cursor++;
+				Cursor_Index = 0;
+
+				// Next Page
+				continue;
+
+			}
+
+			// Read Record
+			if (!Storage->Read(Cursor % Pages, ENV_LOG_HEADER_SIZE + Cursor_Index * ENV_LOG_RECORD_SIZE, Data_, ENV_LOG_RECORD_SIZE)) return(false);
+
+		}
+
+		// Set Record
+		Record_.Time = Get_Long(Data_);
+		Record_.Channel = Data_[4];
+		memcpy(&Record_.Value, &Data_[5], 4);
+
+		// Move Cursor
+		Cursor_Index++;
+		if (Cursor != Head and Cursor_Index >= Page_Records) {
+
+			// Set Next Page
+			Cursor++;
+			Cursor_Index = 0;
+
+		}
+
+		// End Function
+		return(true);
+
+	}
+
+}
+void Environment_Log::Rewind(void) {
+
+	// Set Cursor to Tail
+	Cursor = Tail;
+	Cursor_Index = Tail_Index;
+
+	// Forget Checked Page
+	Checked = ENV_LOG_NONE;
+
+}
+bool Environment_Log::Truncate(void) {
+
+	// Control for Mount
+	if (!Mounted) return(false);
+
+	// Drop Records Before Cursor
+	Tail = Cursor;
+	Tail_Index = Cursor_Index;
+
+	// Store Tail
+	Dirty = true;
+
+	// End Function
+	return(Flush());
+
+}
+
+// Status Functions
+uint32_t Environment_Log::Count(void) {
+
+	// Control for Mount
+	if (!Mounted) return(0);
+
+	// Records From Tail to Head
+	return((Head - Tail) * Page_Records + Page_Fill - Tail_Index);
+
+}
+uint32_t Environment_Log::Unread(void) {
+
+	// Control for Mount
+	if (!Mounted) return(0);
+
+	// Records From Cursor to Head
+	return((Head - Cursor) * Page_Records + Page_Fill - Cursor_Index);
+
+}
+uint32_t Environment_Log::Capacity(void) {
+
+	// Control for Mount
+	if (!Mounted) return(0);
+
+	// Guaranteed Records (the page after head is dropped when head moves on)
+	return((uint32_t)(Pages - 1) * Page_Records);
+
+}
+uint32_t Environment_Log::Dropped(void) {
+
+	// End Function
+	return(Lost);
+
+}
+
+// Private Page Functions
+bool Environment_Log::Write_Page(void) {
+
+	// Set Header
+	Put_Long(&Page[0], Head);
+	Put_Long(&Page[4], Tail);
+	Page[8] = Tail_Index;
+	Page[9] = Page_Fill;
+
+	// Set Check (header and records)
+	uint16_t CRC_ = CRC(0xFFFF, Page, 10);
+	CRC_ = CRC(CRC_, &Page[ENV_LOG_HEADER_SIZE], Page_Fill * ENV_LOG_RECORD_SIZE);
+	Page[10] = (uint8_t)CRC_;
+	Page[11] = (uint8_t)(CRC_ >> 8);
+
+	// Write Page
+	if (!Storage->Write(Head % Pages, Page)) return(false);
+
+	// Page Stored
+	Dirty = false;
+
+	// End Function
+	return(true);
+
+}
+bool Environment_Log::Advance(void) {
+
+	// Write Full Page
+	if (!Write_Page()) return(false);
+
+	// Set Next Page
+	Head++;
+	Page_Fill = 0;
+	memset(Page, 0, sizeof(Page));
+
+	// Drop Overwritten Page
+	Trim();
+
+	// End Function
+	return(true);
+
+}
+void Environment_Log::Trim(void) {
+
+	// Get Oldest Kept Page
+	uint32_t Oldest_ = (Head >= (uint32_t)(Pages - 1)) ? Head - (Pages - 1) : 0;
+
+	// Control for Tail
+	if (Tail < Oldest_) {
+
+		// Count Dropped Records
+		Lost += (Oldest_ - Tail) * Page_Records - Tail_Index;
+
+		// Set Tail
+		Tail = Oldest_;
+		Tail_Index = 0;
+
+	}
+
+	// Control for Cursor
+	if (Cursor < Oldest_) {
+
+		// Set Cursor
+		Cursor = Oldest_;
+		Cursor_Index = 0;
+
+	}
+
+}
+bool Environment_Log::Check_Page(const uint32_t Sequence_, uint8_t & Count_) {
+
+	// Read Header
+	uint8_t Data_[ENV_LOG_CHUNK];
+	if (!Storage->Read(Sequence_ % Pages, 0, Data_, ENV_LOG_HEADER_SIZE)) return(false);
+
+	// Control for Sequence and Count
+	if (Get_Long(Data_) != Sequence_ or Data_[9] > Page_Records) return(false);
+
+	// Get Stored Check
+	uint16_t Stored_ = (uint16_t)Data_[10] | ((uint16_t)Data_[11] << 8);
+
+	// Check Header
+	Count_ = Data_[9];
+	uint16_t CRC_ = CRC(0xFFFF, Data_, 10);
+
+	// Check Records in Chunks
+	uint16_t Offset_ = ENV_LOG_HEADER_SIZE;
+	uint16_t Remain_ = Count_ * ENV_LOG_RECORD_SIZE;
+	while (Remain_ > 0) {
+
+		// Read Chunk
+		uint16_t Length_ = (Remain_ > ENV_LOG_CHUNK) ? ENV_LOG_CHUNK : Remain_;
+		if (!Storage->Read(Sequence_ % Pages, Offset_, Data_, Length_)) return(false);
+
+		// Check Chunk
+		CRC_ = CRC(CRC_, Data_, Length_);
+		Offset_ += Length_;
+		Remain_ -= Length_;
+
+	}
+
+	// End Function
+	return(CRC_ == Stored_);
+
+}
+
+// Private Encoding Functions
+uint16_t Environment_Log::CRC(uint16_t CRC_, const uint8_t * Data_, const uint16_t Length_) {
+
+	// CRC-16/CCITT (polynomial 0x1021)
+	for (uint16_t i = 0; i < Length_; i++) {
+
+		// Add Byte
+		CRC_ ^= (uint16_t)Data_[i] << 8;
+
+		// Shift Bits
+		for (uint8_t Bit_ = 0; Bit_ < 8; Bit_++) CRC_ = (CRC_ & 0x8000) ? (uint16_t)((CRC_ << 1) ^ 0x1021) : (uint16_t)(CRC_ << 1);
+
+	}
+
+	// End Function
+	return(CRC_);
+
+}
+void Environment_Log::Put_Long(uint8_t * Data_, const uint32_t Value_) {
+
+	// Set Bytes (little endian)
+	Data_[0] = (uint8_t)Value_;
+	Data_[1] = (uint8_t)(Value_ >> 8);
+	Data_[2] = (uint8_t)(Value_ >> 16);
+	Data_[3] = (uint8_t)(Value_ >> 24);
+
+}
+uint32_t Environment_Log::Get_Long(const uint8_t * Data_) {
+
+	// Get Bytes (little endian)
+	return((uint32_t)Data_[0] | ((uint32_t)Data_[1] << 8) | ((uint32_t)Data_[2] << 16) | ((uint32_t)Data_[3] << 24));
+
+}
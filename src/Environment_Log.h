@@ -0,0 +1,137 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Reading Log.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Log__
+#define __Environment_Log__
+
+// Define Storage Interface
+#include "Environment_Storage.h"
+
+#include "Environment_Reading.h"
+
+// ************************************************************
+// Log Format
+// ************************************************************
+//
+//	Page	: Sequence (4), Tail sequence (4), Tail index (1), Count (1), CRC-16 (2), Records
+//	Record	: Time (4, millis), Channel (1), Value (4, float or error code)
+//
+//	Page sequence N is always stored in storage page N % Page_Count, so the
+//	log walks round the whole region and every page is written once per lap
+//	(plus one rewrite for each Flush of a partly filled page). The newest
+//	valid page carries the tail, so truncation needs no fixed header cell.
+//	Multi byte fields are little endian.
+
+// Page Buffer Size (largest storage page size)
+#ifndef ENV_LOG_PAGE_SIZE
+#define ENV_LOG_PAGE_SIZE			64
+#endif
+
+// Page Layout
+#define ENV_LOG_HEADER_SIZE			12
+#define ENV_LOG_RECORD_SIZE			9
+
+// Log Record
+struct Environment_Record {
+
+	uint32_t	Time;			// Acquisition time (millis)
+	uint8_t		Channel;		// Channel ID
+	float		Value;			// Calibrated value or error code
+
+};
+
+/*
+ *	Records are collected in a RAM page and written a page at a time. When
+ *	the region is full the oldest page is dropped (newest readings are kept
+ *	through long outages). Read() walks from the tail, Truncate() drops the
+ *	records read so far.
+ */
+class Environment_Log
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Log(Environment_Storage & Storage_);
+
+	// Log Functions (Begin finds the newest page, Clear drops all records)
+	bool Begin(void);
+	bool Clear(void);
+
+	// Write Functions (Flush writes a partly filled page)
+	bool Append(const uint8_t Channel_, const float Value_, const uint32_t Time_ = millis());
+	bool Append(const uint8_t Channel_, const Environment_Reading & Reading_);
+	bool Flush(void);
+
+	// Read Functions
+	bool Read(Environment_Record & Record_);
+	void Rewind(void);
+	bool Truncate(void);
+
+	// Log Status
+	uint32_t Count(void);
+	uint32_t Unread(void);
+	uint32_t Capacity(void);
+	uint32_t Dropped(void);
+
+private:
+
+	// ************************************************************
+	// Log Variables
+	// ************************************************************
+
+	// Storage
+	Environment_Storage * Storage;
+	uint16_t Pages;
+	uint16_t Page_Length;
+	uint8_t Page_Records;
+	bool Mounted;
+
+	// Head Page (RAM buffer)
+	uint8_t Page[ENV_LOG_PAGE_SIZE];
+	uint32_t Head;
+	uint8_t Page_Fill;
+	bool Dirty;
+
+	// Oldest Kept Record
+	uint32_t Tail;
+	uint8_t Tail_Index;
+
+	// Read Cursor
+	uint32_t Cursor;
+	uint8_t Cursor_Index;
+	uint32_t Checked;
+	uint8_t Checked_Count;
+
+	// Dropped Record Counter
+	uint32_t Lost;
+
+	// ************************************************************
+	// Private Functions
+	// ************************************************************
+
+	// Page Functions
+	bool Write_Page(void);
+	bool Advance(void);
+	void Trim(void);
+	bool Check_Page(const uint32_t Sequence_, uint8_t & Count_);
+
+	// Encoding Functions
+	static uint16_t CRC(uint16_t CRC_, const uint8_t * Data_, const uint16_t Length_);
+	static void Put_Long(uint8_t * Data_, const uint32_t Value_);
+	static uint32_t Get_Long(const uint8_t * Data_);
+
+};
+
+#endif /* defined(__Environment_Log__) */
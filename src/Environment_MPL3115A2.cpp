@@ -0,0 +1,210 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - MPL3115A2 Driver.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_MPL3115A2.h"
+
+Environment_MPL3115A2::Environment_MPL3115A2(Environment_Bus & Bus_, const uint8_t Address_) : Environment_Driver(Bus_, Address_, ENV_MPL3115A2_MAX_CLOCK) {
+
+}
+
+// Start Functions
+bool Environment_MPL3115A2::Begin(void) {
+
+	// Set Start Time
+	Start_Begin();
+
+	// Start Bus Session
+	Environment_Bus_Session Session_(*Bus, Device);
+
+	// Read WHO_AM_I Register
+	uint8_t MPL3115A2_Device_Signiture = 0x00;
+	if (Bus->Read_Register(Device, 0b00001100, &MPL3115A2_Device_Signiture, 1) != 0 or MPL3115A2_Device_Signiture != 0b11000100) return(Start_End(ENV_START_NONE));
+
+	// Read CTRL_REG1 and PT_DATA_CFG Registers
+	uint8_t MPL3115A2_CTRL_REG1 = 0x00, MPL3115A2_PT_DATA_CFG = 0x00;
+	if (Bus->Read_Register(Device, 0b00100110, &MPL3115A2_CTRL_REG1, 1) != 0) return(Start_End(ENV_START_NONE));
+	if (Bus->Read_Register(Device, 0b00010011, &MPL3115A2_PT_DATA_CFG, 1) != 0) return(Start_End(ENV_START_NONE));
+
+	// Control for Active Barometer With 128 Oversampling and Data Flags (conversions kept running)
+	if (MPL3115A2_CTRL_REG1 == 0b00111001 and MPL3115A2_PT_DATA_CFG == 0b00000111) return(Start_End(ENV_START_WARM));
+
+	// Set CTRL_REG1 and PT_DATA_CFG Registers
+	if (Bus->Write_Register(Device, 0b00100110, 0b00111001) != 0) return(Start_End(ENV_START_NONE));
+	if (Bus->Write_Register(Device, 0b00010011, 0b00000111) != 0) return(Start_End(ENV_START_NONE));
+
+	// End Function
+	return(Start_End(ENV_START_COLD));
+
+}
+
+// Measurement Functions
+float Environment_MPL3115A2::Pressure(void) {
+
+	// Measure (failed read clears configuration)
+	return(Result(Measure()));
+
+}
+
+float Environment_MPL3115A2::Measure(void) {
+
+	/******************************************************************************
+	 *	Project		: MPL3115A2 Pressure Read Function
+	 *	Developer	: Mehmet Gunce Akkoyun (akkoyun@me.com)
+	 *	Revision	: 04.00.00
+	 *	Release		: 04.11.2020
+	 ******************************************************************************/
+
+	// Set Sensor Definations
+	struct Sensor_Settings {
+		int		Range_Min;
+		int		Range_Max;
+		
+	};
+	Sensor_Settings MPL3115A2[] {
+		
+		500,		// Sensor Range Minimum
+		11000,		// Sensor Range Maximum
+
+	};
+	
+	// Declare Output Variable
+	float Value_;
+
+	// Start Bus Session (device clock, restored on return)
+	Environment_Bus_Session Session_(*Bus, Device);
+
+	// Identify and Configure Unless Registers are Known
+	if (!Configured) {
+
+		// ************************************************************
+		// Controll For WHO_AM_I Register
+		// ************************************************************
+
+		// Read WHO_AM_I Register
+		uint8_t MPL3115A2_Device_Signiture = 0x00;
+		uint8_t MPL3115A2_Sensor_Identification = Bus->Read_Register(Device, 0b00001100, &MPL3115A2_Device_Signiture, 1);
+
+		// Control For Identifier Read Success
+		if (MPL3115A2_Sensor_Identification != 0) return(-101);
+
+		// Control for Device Identifier
+		if (MPL3115A2_Device_Signiture != 0b11000100) return(-101);
+
+		// ************************************************************
+		// Set CTRL_REG1 Register
+		// ************************************************************
+		
+		// Set CTRL_REG1 Register
+		uint8_t MPL3115A2_Sensor_CTRL_REG1_Register = Bus->Write_Register(Device, 0b00100110, 0b00111001);
+		
+		// Control For Register Write
+		if (MPL3115A2_Sensor_CTRL_REG1_Register != 0) return(-102);
+		
+		// ************************************************************
+		// Set PT_DATA_CFG Register
+		// ************************************************************
+		
+		// Set PT_DATA_CFG Register
+		uint8_t MPL3115A2_Sensor_PT_DATA_CFG_Register = Bus->Write_Register(Device, 0b00010011, 0b00000111);
+		
+		// Control For Register Write
+		if (MPL3115A2_Sensor_PT_DATA_CFG_Register != 0) return(-103);
+
+	}
+		
+	// ************************************************************
+	// Read Sensor Datas
+	// ************************************************************
+	
+	// Define Variables
+	uint8_t MPL3115A2_Read_Status = 0;
+	uint8_t Ready_Status_Try_Counter = 0;
+	
+	// ************************************************************
+	// Wait for Measurement Complate
+	// ************************************************************
+	while ((MPL3115A2_Read_Status & 0b00000100) != 0b00000100) {
+		
+		// Read Device Status Register
+		uint8_t MPL3115A2_Sensor_Pressure_Ready_Status = Bus->Read_Register(Device, 0b00000000, &MPL3115A2_Read_Status, 1);
+		
+		// Control For Ready Status Read
+		if (MPL3115A2_Sensor_Pressure_Ready_Status != 0) return(-105);
+		
+		// Increase Counter
+		Ready_Status_Try_Counter += 1;
+		
+		// Control for Wait Counter
+		if (Ready_Status_Try_Counter > 50) return(-106);
+
+		// Ready Status Wait Delay
+		if ((MPL3115A2_Read_Status & 0b00000100) != 0b00000100) Bus->Delay(50);
+		
+	}
+	
+	// ************************************************************
+	// Read Sensor Data
+	// ************************************************************
+	
+	// Define Data Variable
+	uint8_t MPL3115A2_Data[3];
+	
+	// Request Pressure Data (OUT_P_MSB, OUT_P_CSB, OUT_P_LSB)
+	uint8_t MPL3115A2_Sensor_Data_Read = Bus->Read_Register(Device, 0b00000001, MPL3115A2_Data, 3);
+	
+	// Control For Read Command Success
+	if (MPL3115A2_Sensor_Data_Read != 0) return(-107);
+	
+	// ************************************************************
+	// Calculate Measurement Value
+	// ************************************************************
+	
+	// Define Variables
+	uint32_t Measurement_Raw = 0;
+	
+	// Combine Read Bytes
+	Measurement_Raw = MPL3115A2_Data[0];
+	Measurement_Raw <<= 8;
+	Measurement_Raw |= MPL3115A2_Data[1];
+	Measurement_Raw <<= 8;
+	Measurement_Raw |= MPL3115A2_Data[2];
+	Measurement_Raw >>= 4;
+	
+	// Calculate Pressure (mBar)
+	Value_ = (ENV_MPL3115A2_P_CALIBRATION_A * ((Measurement_Raw / 4.00 ) / 100)) + ENV_MPL3115A2_P_CALIBRATION_B;
+
+	// Read Delay
+	Bus->Delay(512);
+
+	// ************************************************************
+	// Control For Sensor Range
+	// ************************************************************
+	if (Value_ <= MPL3115A2[0].Range_Min or Value_ >= MPL3115A2[0].Range_Max) return(-108);
+
+	// End Function
+	return(Value_);
+
+}
+
+// Power Functions
+uint8_t Environment_MPL3115A2::Power_Down(void) {
+
+	// Standby Needs Configuration on Next Read
+	Configured = false;
+
+	// Start Bus Session
+	Environment_Bus_Session Session_(*Bus, Device);
+
+	// Clear SBYB Bit of CTRL_REG1 (standby, OS 128 kept)
+	return(Bus->Write_Register(Device, 0b00100110, 0b00111000));
+
+}
@@ -0,0 +1,56 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - MPL3115A2 Driver.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_MPL3115A2__
+#define __Environment_MPL3115A2__
+
+// Define Driver Base
+#include "Environment_Driver.h"
+
+// Device Address and Clock
+#define ENV_MPL3115A2_ADDRESS		0x60
+#define ENV_MPL3115A2_MAX_CLOCK		400000
+
+// Pressure Calibration (Calibrated = a * Value + b)
+#define ENV_MPL3115A2_P_CALIBRATION_A	1
+#define ENV_MPL3115A2_P_CALIBRATION_B	0
+
+class Environment_MPL3115A2 : public Environment_Driver
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_MPL3115A2(Environment_Bus & Bus_, const uint8_t Address_ = ENV_MPL3115A2_ADDRESS);
+
+	// Warm Start (skips register setup when barometer is already running)
+	bool Begin(void);
+
+	// Measurements
+	float Pressure(void);
+
+	// Power Management
+	uint8_t Power_Down(void);
+
+private:
+
+	// ************************************************************
+	// Private Functions
+	// ************************************************************
+
+	float Measure(void);
+
+};
+
+#endif /* defined(__Environment_MPL3115A2__) */
@@ -0,0 +1,167 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Mapped File Storage.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Mapped.h"
+
+#if defined(ENV_PLATFORM_LINUX)
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+Environment_Mapped_File::Environment_Mapped_File(const char * Path_, const uint16_t Page_Count_, const uint16_t Page_Size_) {
+
+	// Set File
+	Path = Path_;
+	File = -1;
+	Map = NULL;
+
+	// Set Geometry
+	Pages = Page_Count_;
+	Page_Length = Page_Size_;
+
+	// Clear Counter
+	Writes = 0;
+
+}
+Environment_Mapped_File::~Environment_Mapped_File(void) {
+
+	// Unmap and Close File
+	Close();
+
+}
+
+// File Functions
+bool Environment_Mapped_File::Open(void) {
+
+	// Control for Mapped File
+	if (Map != NULL) return(true);
+
+	// Control for Path and Geometry
+	if (Path == NULL or Pages == 0 or Page_Length == 0) return(false);
+
+	// Open File
+	File = open(Path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+	// Control for File
+	if (File < 0) return(false);
+
+	// Set File Size (new bytes read as zero)
+	size_t Size_ = (size_t)Pages * Page_Length;
+	if (ftruncate(File, (off_t)Size_) != 0) {
+
+		// Close File
+		Close();
+
+		// End Function
+		return(false);
+
+	}
+
+	// Map File
+	void * Map_ = mmap(NULL, Size_, PROT_READ | PROT_WRITE, MAP_SHARED, File, 0);
+
+	// Control for Map
+	if (Map_ == MAP_FAILED) {
+
+		// Close File
+		Close();
+
+		// End Function
+		return(false);
+
+	}
+
+	// Set Map
+	Map = (uint8_t *)Map_;
+
+	// End Function
+	return(true);
+
+}
+void Environment_Mapped_File::Close(void) {
+
+	// Unmap File
+	if (Map != NULL) munmap(Map, (size_t)Pages * Page_Length);
+	Map = NULL;
+
+	// Close File
+	if (File >= 0) close(File);
+	File = -1;
+
+}
+uint32_t Environment_Mapped_File::Write_Count(void) {
+
+	// End Function
+	return(Writes);
+
+}
+
+// Geometry Functions
+uint16_t Environment_Mapped_File::Page_Count(void) {
+
+	// End Function
+	return(Pages);
+
+}
+uint16_t Environment_Mapped_File::Page_Size(void) {
+
+	// End Function
+	return(Page_Length);
+
+}
+
+// Page Functions
+bool Environment_Mapped_File::Read(const uint16_t Page_, const uint16_t Offset_, uint8_t * Data_, const uint16_t Length_) {
+
+	// Control for Region
+	if (Page_ >= Pages or Offset_ + Length_ > Page_Length) return(false);
+
+	// Map File
+	if (!Open()) return(false);
+
+	// Read Bytes
+	memcpy(Data_, Map + (size_t)Page_ * Page_Length + Offset_, Length_);
+
+	// End Function
+	return(true);
+
+}
+bool Environment_Mapped_File::Write(const uint16_t Page_, const uint8_t * Data_) {
+
+	// Control for Region
+	if (Page_ >= Pages) return(false);
+
+	// Map File
+	if (!Open()) return(false);
+
+	// Write Page
+	memcpy(Map + (size_t)Page_ * Page_Length, Data_, Page_Length);
+
+	// Count Write
+	Writes++;
+
+	// End Function
+	return(true);
+
+}
+bool Environment_Mapped_File::Sync(void) {
+
+	// Control for Map
+	if (Map == NULL) return(true);
+
+	// Flush Pages to File
+	return(msync(Map, (size_t)Pages * Page_Length, MS_SYNC) == 0);
+
+}
+
+#endif /* defined(ENV_PLATFORM_LINUX) */
@@ -0,0 +1,70 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Mapped File Storage.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Mapped__
+#define __Environment_Mapped__
+
+// Define Storage Interface
+#include "Environment_Storage.h"
+
+#if defined(ENV_PLATFORM_LINUX)
+
+class Environment_Mapped_File : public Environment_Storage
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	// Region File (created or resized and mapped on first access)
+	Environment_Mapped_File(const char * Path_, const uint16_t Page_Count_, const uint16_t Page_Size_);
+
+	~Environment_Mapped_File(void);
+
+	// File Functions
+	bool Open(void);
+	void Close(void);
+	uint32_t Write_Count(void);
+
+	// Region Geometry
+	uint16_t Page_Count(void);
+	uint16_t Page_Size(void);
+
+	// Page Functions
+	bool Read(const uint16_t Page_, const uint16_t Offset_, uint8_t * Data_, const uint16_t Length_);
+	bool Write(const uint16_t Page_, const uint8_t * Data_);
+	bool Sync(void);
+
+private:
+
+	// ************************************************************
+	// File Variables
+	// ************************************************************
+
+	// File
+	const char * Path;
+	int File;
+	uint8_t * Map;
+
+	// Geometry
+	uint16_t Pages;
+	uint16_t Page_Length;
+
+	// Page Write Counter
+	uint32_t Writes;
+
+};
+
+#endif /* defined(ENV_PLATFORM_LINUX) */
+
+#endif /* defined(__Environment_Mapped__) */
@@ -0,0 +1,52 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Platform Layer.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Platform.h"
+
+#if defined(ENV_PLATFORM_LINUX)
+
+#include <time.h>
+
+// Time Functions
+static uint64_t Monotonic_Time(void) {
+
+	// Read Monotonic Clock
+	struct timespec Time_;
+	clock_gettime(CLOCK_MONOTONIC, &Time_);
+
+	// End Function (us)
+	return((uint64_t)Time_.tv_sec * 1000000 + (uint64_t)Time_.tv_nsec / 1000);
+
+}
+uint32_t millis(void) {
+
+	// End Function (wraps like Arduino millis)
+	return((uint32_t)(Monotonic_Time() / 1000));
+
+}
+uint32_t micros(void) {
+
+	// End Function (wraps like Arduino micros)
+	return((uint32_t)Monotonic_Time());
+
+}
+void delay(const uint32_t Time_) {
+
+	// Set Sleep Time
+	struct timespec Sleep_ = {(time_t)(Time_ / 1000), (long)(Time_ % 1000) * 1000000L};
+
+	// Sleep (continue after signals)
+	while (nanosleep(&Sleep_, &Sleep_) != 0);
+
+}
+
+#endif /* defined(ENV_PLATFORM_LINUX) */
@@ -0,0 +1,60 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Platform Layer.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Platform__
+#define __Environment_Platform__
+
+#if defined(ARDUINO)
+
+	// Arduino Platform (Wire transport)
+	#define ENV_PLATFORM_WIRE
+
+	// Define Arduino Library
+	#ifndef __Arduino__
+	#include <Arduino.h>
+	#endif
+
+	// Define Wire Library
+	#ifndef __Wire__
+	#include <Wire.h>
+	#endif
+
+#elif defined(__linux__)
+
+	// Linux Platform (i2c-dev transport)
+	#define ENV_PLATFORM_LINUX
+
+	// Define C Libraries
+	#include <stdint.h>
+	#include <stddef.h>
+	#include <string.h>
+	#include <math.h>
+
+	// Flash Access (program memory is ordinary memory)
+	#define PROGMEM
+	#define pgm_read_byte(Address_)		(*(const uint8_t *)(Address_))
+	#define pgm_read_word(Address_)		(*(const uint16_t *)(Address_))
+	#define pgm_read_dword(Address_)	(*(const uint32_t *)(Address_))
+	#define memcpy_P					memcpy
+
+	// Time Functions (monotonic clock, Environment_Platform.cpp)
+	uint32_t millis(void);
+	uint32_t micros(void);
+	void delay(const uint32_t Time_);
+
+#else
+
+	#error "Environment library supports Arduino and Linux platforms"
+
+#endif
+
+#endif /* defined(__Environment_Platform__) */
@@ -0,0 +1,64 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Reading Definations.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Reading__
+#define __Environment_Reading__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// ************************************************************
+// Channel Definations
+// ************************************************************
+
+// Channel ID
+#define ENV_SHT21_TEMPERATURE		0
+#define ENV_SHT21_HUMIDITY			1
+#define ENV_HDC2010_TEMPERATURE		2
+#define ENV_HDC2010_HUMIDITY		3
+#define ENV_MPL3115A2_PRESSURE		4
+#define ENV_TSL2561_LIGHT			5
+#define ENV_CHANNEL_COUNT			6
+
+// Sensor functions return error codes at or below this value
+#define ENV_ERROR_LIMIT				-100
+
+// Asynchronous transaction failed on the bus
+#define ENV_ERROR_BUS				-109
+
+// No acquisition fits the read deadline and no earlier reading to reuse
+#define ENV_ERROR_DEADLINE			-110
+
+// Result frame failed its checksum
+#define ENV_ERROR_CRC				-111
+
+// Partial Result Mode (SHT21 and HDC2010 sample loop)
+#define ENV_PARTIAL_OFF				0xFF	// Any failed sample fails the whole read
+#ifndef ENV_SAMPLE_RETRY
+#define ENV_SAMPLE_RETRY			2		// Default retries of a failed sample before it is dropped
+#endif
+
+// Channel Reading
+struct Environment_Reading {
+
+	float		Value;			// Calibrated value or error code
+	uint32_t	Time;			// Acquisition time (millis)
+	float		Min;			// Sample minimum
+	float		Max;			// Sample maximum
+	float		Deviation;		// Sample standard deviation
+	uint8_t		Count;			// Sample count
+	int16_t		Error;			// 0 or sensor function error code
+	uint8_t		Failed;			// Samples dropped after all retries (partial result mode)
+
+};
+
+#endif /* defined(__Environment_Reading__) */
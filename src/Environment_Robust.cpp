@@ -0,0 +1,258 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Robust Average Kernels.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Robust.h"
+
+// Optimal Sorting Networks for 2 - 8 Elements (comparator = Low << 4 | High)
+const uint8_t ENV_NETWORK[] PROGMEM = {
+
+	0x01,																								// 2 : 1
+	0x12, 0x02, 0x01,																					// 3 : 3
+	0x01, 0x23, 0x02, 0x13, 0x12,																		// 4 : 5
+	0x01, 0x34, 0x24, 0x23, 0x03, 0x02, 0x14, 0x13, 0x12,												// 5 : 9
+	0x12, 0x45, 0x02, 0x35, 0x01, 0x34, 0x25, 0x03, 0x14, 0x24, 0x13, 0x23,								// 6 : 12
+	0x12, 0x34, 0x56, 0x02, 0x35, 0x46, 0x01, 0x45, 0x26, 0x04, 0x15, 0x03, 0x25, 0x13, 0x24, 0x23,		// 7 : 16
+	0x01, 0x23, 0x45, 0x67, 0x02, 0x13, 0x46, 0x57, 0x12, 0x56, 0x04, 0x37, 0x15, 0x26, 0x14, 0x36,		// 8 : 19
+	0x24, 0x35, 0x34
+
+};
+
+// Network Start Offsets (index is element count, last entry is table end)
+const uint8_t ENV_NETWORK_START[] PROGMEM = {0, 0, 0, 1, 4, 9, 18, 30, 46, 65};
+
+// Dispatch Functions
+float Environment_Robust::Estimate(uint16_t * Data_, const uint8_t Count_, const uint8_t Average_Type_) {
+
+	// Select Estimator
+	switch (Average_Type_) {
+
+		case ENV_AVERAGE_MEDIAN:	return(Median(Data_, Count_));
+		case ENV_AVERAGE_TRIMMED:	return(Trimmed_Mean(Data_, Count_));
+		case ENV_AVERAGE_MAD:		return(MAD_Mean(Data_, Count_));
+		default:					return(Mean(Data_, Count_));
+
+	}
+
+}
+
+// Estimator Functions
+float Environment_Robust::Mean(const uint16_t * Data_, const uint8_t Count_) {
+
+	// Control for Data
+	if (Count_ == 0) return(0);
+
+	// Integer Sum (255 x 65535 fits 32 bit)
+	uint32_t Sum_ = 0;
+	for (uint8_t i = 0; i < Count_; i++) Sum_ += Data_[i];
+
+	// End Function
+	return((float)Sum_ / Count_);
+
+}
+float Environment_Robust::Median(uint16_t * Data_, const uint8_t Count_) {
+
+	// Control for Data
+	if (Count_ == 0) return(0);
+
+	// Middle Rank
+	uint8_t Middle_ = Count_ / 2;
+
+	// Small Count: Sorting Network
+	if (Count_ <= ENV_NETWORK_SIZE) {
+
+		// Sort Data
+		Sort(Data_, Count_);
+
+		// End Function
+		return((Count_ & 1) ? Data_[Middle_] : ((float)Data_[Middle_ - 1] + Data_[Middle_]) / 2);
+
+	}
+
+	// Large Count: Quickselect Upper Middle
+	uint16_t Upper_ = Select(Data_, Count_, Middle_);
+
+	// Control for Odd Count
+	if (Count_ & 1) return(Upper_);
+
+	// Lower Middle is the Largest Element Below Upper Middle
+	uint16_t Lower_ = Data_[0];
+	for (uint8_t i = 1; i < Middle_; i++) if (Data_[i] > Lower_) Lower_ = Data_[i];
+
+	// End Function
+	return(((float)Lower_ + Upper_) / 2);
+
+}
+float Environment_Robust::Trimmed_Mean(uint16_t * Data_, const uint8_t Count_, const uint8_t Trim_Percent_) {
+
+	// Control for Data
+	if (Count_ == 0) return(0);
+
+	// Samples Cut From Each End (at least one sample is kept)
+	uint8_t Trim_ = (uint16_t)Count_ * Trim_Percent_ / 100;
+	if (2 * Trim_ >= Count_) Trim_ = (Count_ - 1) / 2;
+
+	// Control for Trim
+	if (Trim_ == 0) return(Mean(Data_, Count_));
+
+	// Move Trimmed Samples to Both Ends
+	if (Count_ <= ENV_NETWORK_SIZE) {
+
+		// Sort Data
+		Sort(Data_, Count_);
+
+	} else {
+
+		// Lowest Trim_ Samples to Front
+		Select(Data_, Count_, Trim_);
+
+		// Highest Trim_ Samples to Back
+		Select(Data_ + Trim_, Count_ - Trim_, Count_ - 2 * Trim_ - 1);
+
+	}
+
+	// End Function
+	return(Mean(Data_ + Trim_, Count_ - 2 * Trim_));
+
+}
+float Environment_Robust::MAD_Mean(uint16_t * Data_, const uint8_t Count_, const float Threshold_) {
+
+	// Control for Data
+	if (Count_ < 3) return(Mean(Data_, Count_));
+
+	// Calculate Median
+	float Median_ = Median(Data_, Count_);
+
+	// Calculate Absolute Deviations (code units, rounded up)
+	uint16_t Deviation_[Count_];
+	for (uint8_t i = 0; i < Count_; i++) Deviation_[i] = (uint16_t)ceil(fabs((float)Data_[i] - Median_));
+
+	// Calculate Rejection Limit (at least one code, MAD is 0 on quantised flat signals)
+	float Limit_ = Threshold_ * ENV_MAD_SIGMA * Median(Deviation_, Count_);
+	if (Limit_ < 1) Limit_ = 1;
+
+	// Average Samples Inside Limit
+	uint32_t Sum_ = 0;
+	uint8_t Kept_ = 0;
+	for (uint8_t i = 0; i < Count_; i++) {
+
+		// Control for Spike
+		if (fabs((float)Data_[i] - Median_) > Limit_) continue;
+
+		// Add Sample
+		Sum_ += Data_[i];
+		Kept_++;
+
+	}
+
+	// End Function
+	return((Kept_ == 0) ? Median_ : (float)Sum_ / Kept_);
+
+}
+
+// Ordering Functions
+void Environment_Robust::Sort(uint16_t * Data_, const uint8_t Count_) {
+
+	// Small Count: Sorting Network
+	if (Count_ <= ENV_NETWORK_SIZE) {
+
+		// Get Network Range
+		uint8_t End_ = pgm_read_byte(&ENV_NETWORK_START[Count_ + 1]);
+
+		// Run Comparators
+		for (uint8_t i = pgm_read_byte(&ENV_NETWORK_START[Count_]); i < End_; i++) {
+
+			// Read Comparator
+			uint8_t Pair_ = pgm_read_byte(&ENV_NETWORK[i]);
+			uint16_t & Low_ = Data_[Pair_ >> 4];
+			uint16_t & High_ = Data_[Pair_ & 0x0F];
+
+			// Compare and Exchange
+			if (Low_ > High_) {
+
+				uint16_t Swap_ = Low_;
+				Low_ = High_;
+				High_ = Swap_;
+
+			}
+
+		}
+
+		// End Function
+		return;
+
+	}
+
+	// Large Count: Insertion Sort (sensor data is mostly ordered noise)
+	for (uint8_t i = 1; i < Count_; i++) {
+
+		// Insert Element
+		uint16_t Key_ = Data_[i];
+		uint8_t j = i;
+		while (j > 0 and Data_[j - 1] > Key_) {
+
+			Data_[j] = Data_[j - 1];
+			j--;
+
+		}
+		Data_[j] = Key_;
+
+	}
+
+}
+uint16_t Environment_Robust::Select(uint16_t * Data_, const uint8_t Count_, const uint8_t Rank_) {
+
+	// Declare Partition Range
+	uint8_t Left_ = 0;
+	uint8_t Right_ = Count_ - 1;
+
+	// Narrow Range Until Rank is Placed
+	while (Right_ > Left_) {
+
+		// Median of Three Pivot (guards against sorted input)
+		uint8_t Middle_ = Left_ + (Right_ - Left_) / 2;
+		uint16_t A_ = Data_[Left_], B_ = Data_[Middle_], C_ = Data_[Right_];
+		uint16_t Pivot_ = (A_ < B_) ? ((B_ < C_) ? B_ : ((A_ < C_) ? C_ : A_)) : ((A_ < C_) ? A_ : ((B_ < C_) ? C_ : B_));
+
+		// Hoare Partition
+		uint8_t i = Left_;
+		uint8_t j = Right_;
+		while (i <= j) {
+
+			// Find Misplaced Pair
+			while (Data_[i] < Pivot_) i++;
+			while (Data_[j] > Pivot_) j--;
+
+			// Exchange Pair
+			if (i <= j) {
+
+				uint16_t Swap_ = Data_[i];
+				Data_[i] = Data_[j];
+				Data_[j] = Swap_;
+				i++;
+				if (j == 0) break;
+				j--;
+
+			}
+
+		}
+
+		// Continue in Part Holding Rank
+		if (Rank_ <= j) Right_ = j;
+		else if (Rank_ >= i) Left_ = i;
+		else break;
+
+	}
+
+	// End Function
+	return(Data_[Rank_]);
+
+}
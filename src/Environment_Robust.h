@@ -0,0 +1,62 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Robust Average Kernels.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Robust__
+#define __Environment_Robust__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// Built In Average Types (lower types are passed to Statistical)
+#define ENV_AVERAGE_MEAN			10		// Integer sum mean of raw codes
+#define ENV_AVERAGE_MEDIAN			11		// Median
+#define ENV_AVERAGE_TRIMMED			12		// Trimmed mean (ENV_TRIM_PERCENT cut from each end)
+#define ENV_AVERAGE_MAD				13		// Mean of samples within ENV_MAD_THRESHOLD scaled MADs of the median
+
+// Robust Settings
+#define ENV_TRIM_PERCENT			25		// Interquartile mean
+#define ENV_MAD_THRESHOLD			3.0		// Rejection limit (sigma)
+#define ENV_MAD_SIGMA				1.4826	// MAD to sigma (normal)
+#define ENV_NETWORK_SIZE			8		// Largest sorting network, quickselect above
+
+/*
+ *	All kernels work on raw uint16_t codes in place (the array order is
+ *	changed) and return the estimate in code units as float, so half code
+ *	medians are kept. Conversion to channel units is linear and done once.
+ *
+ *	Count <= 8 : optimal sorting network (PROGMEM comparator table)
+ *	Count > 8  : quickselect (median of three pivot), O(n) average
+ */
+class Environment_Robust
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	// Average Type Dispatch
+	static float Estimate(uint16_t * Data_, const uint8_t Count_, const uint8_t Average_Type_);
+
+	// Estimators
+	static float Mean(const uint16_t * Data_, const uint8_t Count_);
+	static float Median(uint16_t * Data_, const uint8_t Count_);
+	static float Trimmed_Mean(uint16_t * Data_, const uint8_t Count_, const uint8_t Trim_Percent_ = ENV_TRIM_PERCENT);
+	static float MAD_Mean(uint16_t * Data_, const uint8_t Count_, const float Threshold_ = ENV_MAD_THRESHOLD);
+
+	// Ordering Kernels
+	static void Sort(uint16_t * Data_, const uint8_t Count_);
+	static uint16_t Select(uint16_t * Data_, const uint8_t Count_, const uint8_t Rank_);
+
+};
+
+#endif /* defined(__Environment_Robust__) */
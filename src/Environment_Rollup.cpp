@@ -0,0 +1,238 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Windowed Rollups.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Rollup.h"
+
+Environment_Rollup::Environment_Rollup(const uint8_t Channel_, const uint32_t Length_, const uint8_t Type_) {
+
+	// Set Window
+	Window_Channel = Channel_;
+	Window_Type = Type_;
+
+	// Tumbling Uses Current (0) and Closed (1) Pane, Sliding Splits Window Into Panes
+	Pane_Count = (Type_ == ENV_ROLLUP_SLIDING) ? ENV_ROLLUP_PANES : 2;
+	Pane_Length = (Type_ == ENV_ROLLUP_SLIDING) ? Length_ / ENV_ROLLUP_PANES : Length_;
+	if (Pane_Length == 0) Pane_Length = 1;
+
+	// Not Attached
+	Next = NULL;
+
+	// Clear Window
+	Clear();
+
+}
+
+// Window Functions
+void Environment_Rollup::Add(const float Value_, const uint32_t Time_) {
+
+	// Move to Pane of Reading
+	Advance(Time_);
+
+	// Get Current Pane (tumbling window fills pane 0)
+	Environment_Pane & Pane_ = Pane[(Window_Type == ENV_ROLLUP_SLIDING) ? Current : 0];
+
+	// First Reading of Pane
+	if (Pane_.Count == 0) {
+
+		// Set Pane
+		Pane_ = {Value_, Value_, Value_, 0, 1};
+
+		// End Function
+		return;
+
+	}
+
+	// Set Limits
+	if (Value_ < Pane_.Min) Pane_.Min = Value_;
+	if (Value_ > Pane_.Max) Pane_.Max = Value_;
+
+	// Control for Count Limit (limits still follow)
+	if (Pane_.Count == 0xFFFF) return;
+
+	// Sum Offset
+	Pane_.Sum += Value_ - Pane_.Offset;
+	Pane_.Count++;
+
+}
+void Environment_Rollup::Clear(void) {
+
+	// Clear Panes
+	for (uint8_t i = 0; i < ENV_ROLLUP_PANES; i++) Pane[i] = {0, 0, 0, 0, 0};
+
+	// Clear State
+	Pane_Start = 0;
+	Closed_Start = 0;
+	Current = 0;
+	Filled = 0;
+	Started = false;
+	Closed = false;
+
+}
+
+// Result Functions
+bool Environment_Rollup::Ready(const uint32_t Time_) {
+
+	// Close Ended Windows
+	Advance(Time_);
+
+	// Sliding Window is Always Readable, Tumbling After a Window Closed
+	return((Window_Type == ENV_ROLLUP_SLIDING) ? Started : Closed);
+
+}
+Environment_Aggregate Environment_Rollup::Result(const uint32_t Time_) {
+
+	// Close Ended Windows
+	Advance(Time_);
+
+	// Declare Aggregate
+	Environment_Aggregate Aggregate_ = {0, 0, 0, 0, 0};
+	float Reference_ = 0;
+
+	// Control for Start
+	if (!Started) return(Aggregate_);
+
+	// Tumbling: Last Closed Window
+	if (Window_Type != ENV_ROLLUP_SLIDING) {
+
+		// Merge Closed Pane
+		Merge(Aggregate_, Reference_, Pane[1]);
+		Aggregate_.Start = Closed_Start;
+
+		// Result Taken
+		Closed = false;
+
+		// End Function
+		return(Aggregate_);
+
+	}
+
+	// Sliding: Merge All Panes (stale panes are cleared by Advance)
+	for (uint8_t i = 0; i < Pane_Count; i++) Merge(Aggregate_, Reference_, Pane[i]);
+
+	// Window Starts at Oldest Pane Since Start (never before first pane)
+	Aggregate_.Start = Pane_Start - (uint32_t)(Filled - 1) * Pane_Length;
+
+	// End Function
+	return(Aggregate_);
+
+}
+
+// Setting Functions
+uint8_t Environment_Rollup::Channel(void) {
+
+	// End Function
+	return(Window_Channel);
+
+}
+uint32_t Environment_Rollup::Length(void) {
+
+	// End Function
+	return((Window_Type == ENV_ROLLUP_SLIDING) ? Pane_Length * ENV_ROLLUP_PANES : Pane_Length);
+
+}
+
+// Private Functions
+void Environment_Rollup::Advance(const uint32_t Time_) {
+
+	// First Pane
+	if (!Started) {
+
+		// Set Current Pane (aligned to pane length)
+		Pane_Start = Time_ - Time_ % Pane_Length;
+		Current = 0;
+		Filled = 1;
+		Started = true;
+
+		// End Function
+		return;
+
+	}
+
+	// Control for Older Time (stays in current pane, overflow safe)
+	if ((int32_t)(Time_ - Pane_Start) < 0) return;
+
+	// Calculate Elapsed Panes (overflow safe)
+	uint32_t Steps_ = (uint32_t)(Time_ - Pane_Start) / Pane_Length;
+
+	// Control for Pane Change
+	if (Steps_ == 0) return;
+
+	// Calculate Next Pane Start (aligned again after millis overflow, the pane ending at overflow is shorter)
+	uint32_t Next_Start_ = Pane_Start + Steps_ * Pane_Length;
+	if (Next_Start_ < Pane_Start) Next_Start_ = Time_ - Time_ % Pane_Length;
+
+	// Tumbling Window Closed
+	if (Window_Type != ENV_ROLLUP_SLIDING) {
+
+		// Keep Window With Readings as Last Closed Window (pane 1)
+		if (Pane[0].Count > 0) {
+
+			// Close Window
+			Pane[1] = Pane[0];
+			Closed_Start = Pane_Start;
+			Closed = true;
+
+		}
+
+		// Start Next Window
+		Pane[0] = {0, 0, 0, 0, 0};
+		Pane_Start = Next_Start_;
+
+		// End Function
+		return;
+
+	}
+
+	// Move Pane Start
+	Pane_Start = Next_Start_;
+
+	// Clear Panes Between (all panes on long gaps)
+	if (Steps_ > Pane_Count) Steps_ = Pane_Count;
+	for (uint8_t i = 1; i <= Steps_; i++) Pane[(Current + i) % Pane_Count] = {0, 0, 0, 0, 0};
+
+	// Set Current Pane
+	Current = (Current + Steps_) % Pane_Count;
+
+	// Count Panes Since Start (window length when full)
+	Filled = (Filled + Steps_ > Pane_Count) ? Pane_Count : Filled + Steps_;
+
+}
+void Environment_Rollup::Merge(Environment_Aggregate & Aggregate_, float & Reference_, const Environment_Pane & Pane_) {
+
+	// Control for Pane
+	if (Pane_.Count == 0) return;
+
+	// First Pane Sets Reference
+	if (Aggregate_.Count == 0) {
+
+		// Set Aggregate
+		Aggregate_.Min = Pane_.Min;
+		Aggregate_.Max = Pane_.Max;
+		Aggregate_.Mean = 0;
+		Reference_ = Pane_.Offset;
+
+	}
+
+	// Set Limits
+	if (Pane_.Min < Aggregate_.Min) Aggregate_.Min = Pane_.Min;
+	if (Pane_.Max > Aggregate_.Max) Aggregate_.Max = Pane_.Max;
+
+	// Running Mean of Offsets to Reference
+	uint32_t Count_ = (uint32_t)Aggregate_.Count + Pane_.Count;
+	float Pane_Mean_ = (Pane_.Offset - Reference_) + Pane_.Sum / Pane_.Count;
+	float Previous_ = (Aggregate_.Count == 0) ? 0 : Aggregate_.Mean - Reference_;
+	Aggregate_.Mean = Reference_ + Previous_ + (Pane_Mean_ - Previous_) * Pane_.Count / Count_;
+
+	// Set Count (saturates)
+	Aggregate_.Count = (Count_ > 0xFFFF) ? 0xFFFF : Count_;
+
+}
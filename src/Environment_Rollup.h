@@ -0,0 +1,114 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Windowed Rollups.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Rollup__
+#define __Environment_Rollup__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// Window Types
+#define ENV_ROLLUP_TUMBLING			0		// Back to back windows, result is the last closed window
+#define ENV_ROLLUP_SLIDING			1		// Window ending now, moves in pane steps
+
+// Pane Count (sliding step is Length / ENV_ROLLUP_PANES)
+#ifndef ENV_ROLLUP_PANES
+#define ENV_ROLLUP_PANES			4
+#endif
+
+// Window Aggregate
+struct Environment_Aggregate {
+
+	float		Min;			// Minimum value
+	float		Max;			// Maximum value
+	float		Mean;			// Mean value
+	uint16_t	Count;			// Reading count (0 when window is empty)
+	uint32_t	Start;			// Window start time (millis, aligned to window or pane length)
+
+};
+
+// Pane Accumulator
+struct Environment_Pane {
+
+	float		Min;			// Minimum value
+	float		Max;			// Maximum value
+	float		Offset;			// First value (keeps float precision of sum)
+	float		Sum;			// Sum of offsets to first value
+	uint16_t	Count;			// Reading count
+
+};
+
+/*
+ *	Windows are aligned to multiples of the pane length on the millis time
+ *	base, so a 60000 mS window closes on every full minute of uptime. Memory
+ *	is fixed (ENV_ROLLUP_PANES panes) whatever the reading rate. Panes move
+ *	on elapsed time and are aligned again at the millis overflow, where the
+ *	pane ending at the overflow is cut short (2^32 is not a multiple of most
+ *	lengths).
+ */
+class Environment_Rollup
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Rollup(const uint8_t Channel_, const uint32_t Length_, const uint8_t Type_ = ENV_ROLLUP_TUMBLING);
+
+	// Window Functions
+	void Add(const float Value_, const uint32_t Time_);
+	void Clear(void);
+
+	// Results (Time_ closes windows that ended without a reading)
+	bool Ready(const uint32_t Time_ = millis());
+	Environment_Aggregate Result(const uint32_t Time_ = millis());
+
+	// Window Settings
+	uint8_t Channel(void);
+	uint32_t Length(void);
+
+private:
+
+	// ************************************************************
+	// Rollup Variables
+	// ************************************************************
+
+	// Settings
+	uint8_t Window_Channel;
+	uint8_t Window_Type;
+	uint8_t Pane_Count;
+	uint32_t Pane_Length;
+
+	// Pane Ring (pane start times are millis, compared by overflow safe deltas)
+	Environment_Pane Pane[ENV_ROLLUP_PANES];
+	uint32_t Pane_Start;
+	uint32_t Closed_Start;
+	uint8_t Current;
+	uint8_t Filled;
+	bool Started;
+	bool Closed;
+
+	// Reading List (owned by Environment)
+	Environment_Rollup * Next;
+	friend class Environment;
+
+	// ************************************************************
+	// Private Functions
+	// ************************************************************
+
+	void Advance(const uint32_t Time_);
+	static void Merge(Environment_Aggregate & Aggregate_, float & Reference_, const Environment_Pane & Pane_);
+
+};
+
+#endif /* defined(__Environment_Rollup__) */
@@ -0,0 +1,110 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - SHT21 Driver.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_SHT21.h"
+
+// SHT21 Temperature Resolutions: user register bits 7 and 0, maximum conversion time
+const Environment_Resolution ENV_SHT21_T_RESOLUTION[] PROGMEM = {
+	{14, 0x00, 85000},
+	{13, 0x80, 43000},
+	{12, 0x01, 22000},
+	{11, 0x81, 11000}
+};
+
+// SHT21 Humidity Resolutions: user register bits 7 and 0, maximum conversion time
+const Environment_Resolution ENV_SHT21_H_RESOLUTION[] PROGMEM = {
+	{12, 0x00, 29000},
+	{11, 0x81, 15000},
+	{10, 0x80, 9000},
+	{8, 0x01, 4000}
+};
+
+// SHT21 Temperature: user register 12 bit RH / 14 bit T with OTP reload disabled, hold master 0xE3
+const Environment_Descriptor ENV_SHT21_T_DESCRIPTOR PROGMEM = {ENV_PROTOCOL_SHT21, 0x00, 0b00000010, 0x00, 0x00, 0b11100011, 0xFFFC, -46.85, 175.72, -40, 100, 1.0129, 0.6075, 0x81, ENV_SHT21_T_RESOLUTION, 4};
+
+// SHT21 Humidity: user register 12 bit RH / 14 bit T, hold master 0xE5
+const Environment_Descriptor ENV_SHT21_H_DESCRIPTOR PROGMEM = {ENV_PROTOCOL_SHT21, 0x00, 0b00000000, 0x00, 0x00, 0b11100101, 0xFFFC, -6, 125, 0, 100, 0.9518, 3.5316, 0x81, ENV_SHT21_H_RESOLUTION, 4};
+
+Environment_SHT21::Environment_SHT21(Environment_Bus & Bus_, const uint8_t Address_) : Environment_Driver(Bus_, Address_, ENV_SHT21_MAX_CLOCK) {
+
+}
+
+// Start Functions
+bool Environment_SHT21::Begin(void) {
+
+	// Set Start Time
+	Start_Begin();
+
+	// Control for Intact Configuration (either channel)
+	if (Environment_Acquisition::Check(*Bus, Device, &ENV_SHT21_T_DESCRIPTOR) or Environment_Acquisition::Check(*Bus, Device, &ENV_SHT21_H_DESCRIPTOR)) return(Start_End(ENV_START_WARM));
+
+	// Soft Reset and Configure
+	if (Environment_Acquisition::Reset(*Bus, Device, &ENV_SHT21_T_DESCRIPTOR) != 0) return(Start_End(ENV_START_NONE));
+
+	// End Function
+	return(Start_End(ENV_START_COLD));
+
+}
+
+// Measurement Functions
+float Environment_SHT21::Temperature(const uint8_t Read_Count_, const uint8_t Average_Type_, const Environment_Adaptive * Adaptive_, Environment_Reading * Summary_, const uint8_t Resolution_) {
+
+	// Read Channel
+	return(Result(Environment_Acquisition::Read(*Bus, Device, &ENV_SHT21_T_DESCRIPTOR, Read_Count_, Average_Type_, Adaptive_, Summary_, Configured, Retry, Resolution_)));
+
+}
+float Environment_SHT21::Humidity(const uint8_t Read_Count_, const uint8_t Average_Type_, const Environment_Adaptive * Adaptive_, Environment_Reading * Summary_, const uint8_t Resolution_) {
+
+	// Read Channel
+	return(Result(Environment_Acquisition::Read(*Bus, Device, &ENV_SHT21_H_DESCRIPTOR, Read_Count_, Average_Type_, Adaptive_, Summary_, Configured, Retry, Resolution_)));
+
+}
+bool Environment_SHT21::Read(float & Temperature_, float & Humidity_, const uint8_t Temperature_Resolution_, const uint8_t Humidity_Resolution_) {
+
+	// Read Channel Pair
+	int16_t Error_ = Environment_Acquisition::Pair(*Bus, Device, &ENV_SHT21_T_DESCRIPTOR, &ENV_SHT21_H_DESCRIPTOR, Configured, Temperature_Resolution_, Humidity_Resolution_, Temperature_, Humidity_);
+
+	// Set Start State (any failed frame needs full reset)
+	Result((Error_ != 0) ? Error_ : Temperature_);
+
+	// End Function
+	return(Error_ == 0);
+
+}
+float Environment_SHT21::Compensate(const float Temperature_, const float Humidity_) {
+
+	// Control for Valid Readings
+	if (Humidity_ <= ENV_ERROR_LIMIT) return(Humidity_);
+	if (Temperature_ <= ENV_ERROR_LIMIT) return(Temperature_);
+
+	// Control for Compensation Range
+	if (Temperature_ < 0 or Temperature_ > 80) return(Humidity_);
+
+	// Compensate Humidity to Reference Temperature
+	float Compensated_ = Humidity_ + (ENV_SHT21_H_REFERENCE - Temperature_) * ENV_SHT21_H_COEFFICIENT;
+
+	// Limit Humidity
+	if (Compensated_ < 0) Compensated_ = 0;
+	if (Compensated_ > 100) Compensated_ = 100;
+
+	// End Function
+	return(Compensated_);
+
+}
+
+// Power Functions
+uint8_t Environment_SHT21::Power_Down(void) {
+
+	// SHT21 Goes Idle After Every Conversion
+	return(ENV_BUS_OK);
+
+}
@@ -0,0 +1,62 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - SHT21 Driver.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_SHT21__
+#define __Environment_SHT21__
+
+// Define Driver Base
+#include "Environment_Driver.h"
+
+// Define Acquisition Engine
+#include "Environment_Descriptor.h"
+
+// Device Address and Clock
+#define ENV_SHT21_ADDRESS			0x40
+#define ENV_SHT21_MAX_CLOCK			400000
+
+// Humidity Temperature Compensation (datasheet coefficient, 0 - 80 C)
+#define ENV_SHT21_H_COEFFICIENT		-0.15	// %RH / C
+#define ENV_SHT21_H_REFERENCE		25		// C
+
+// Channel Descriptors
+extern const Environment_Descriptor ENV_SHT21_T_DESCRIPTOR PROGMEM;
+extern const Environment_Descriptor ENV_SHT21_H_DESCRIPTOR PROGMEM;
+
+class Environment_SHT21 : public Environment_Driver
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_SHT21(Environment_Bus & Bus_, const uint8_t Address_ = ENV_SHT21_ADDRESS);
+
+	// Warm Start (skips reset when configuration is intact)
+	bool Begin(void);
+
+	// Measurements (optional adaptive settings, sample statistics and resolution bits)
+	float Temperature(const uint8_t Read_Count_ = 1, const uint8_t Average_Type_ = 1, const Environment_Adaptive * Adaptive_ = NULL, Environment_Reading * Summary_ = NULL, const uint8_t Resolution_ = ENV_RESOLUTION_DEFAULT);
+	float Humidity(const uint8_t Read_Count_ = 1, const uint8_t Average_Type_ = 1, const Environment_Adaptive * Adaptive_ = NULL, Environment_Reading * Summary_ = NULL, const uint8_t Resolution_ = ENV_RESOLUTION_DEFAULT);
+
+	// Pipelined Temperature and Humidity Read (one setup, humidity triggered as soon as temperature is fetched, true when both are valid)
+	bool Read(float & Temperature_, float & Humidity_, const uint8_t Temperature_Resolution_ = ENV_RESOLUTION_DEFAULT, const uint8_t Humidity_Resolution_ = ENV_RESOLUTION_DEFAULT);
+
+	// Temperature Compensated Humidity
+	static float Compensate(const float Temperature_, const float Humidity_);
+
+	// Power Management
+	uint8_t Power_Down(void);
+
+};
+
+#endif /* defined(__Environment_SHT21__) */
@@ -0,0 +1,304 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Fixed Rate Sampler.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Sampler.h"
+
+Environment_Sampler::Environment_Sampler(Environment_Sample * Buffer_, const uint8_t Size_, Environment & Sensor_) {
+
+	// Set Sensor Object
+	Sensor_Object = &Sensor_;
+
+	// Set Ring Buffer (invalid size leaves sampler unusable)
+	Buffer = Buffer_;
+	Mask = (Size_ != 0 and Size_ <= ENV_SAMPLER_MAX_SIZE and (Size_ & (Size_ - 1)) == 0) ? Size_ - 1 : 0;
+	Head = 0;
+	Tail = 0;
+
+	// Not Running
+	Channel = 0;
+	Sample_Period = 0;
+	External = false;
+	Running = false;
+	Busy = false;
+	Ticks = 0;
+	Ticks_Seen = 0;
+	Next_Due = 0;
+	Start_Time = 0;
+	Last_Start = 0;
+
+	// Clear Statistics
+	Reset_Statistics();
+
+}
+
+// Control Functions
+bool Environment_Sampler::Begin(const uint8_t Channel_, const uint32_t Period_, const bool External_) {
+
+	// Control for Settings
+	if (Buffer == NULL or Mask == 0 or Channel_ >= ENV_CHANNEL_COUNT or Period_ == 0) return(false);
+
+	// Set Sampler
+	Channel = Channel_;
+	Sample_Period = Period_;
+	External = External_;
+
+	// Clear Ring
+	Head = 0;
+	Tail = 0;
+
+	// Start Slots (first slot now)
+	Ticks_Seen = Ticks;
+	Next_Due = micros();
+	Busy = false;
+	Last_Start = 0;
+
+	// Clear Statistics
+	Reset_Statistics();
+
+	// Start Sampler
+	Running = true;
+
+	// End Function
+	return(true);
+
+}
+void Environment_Sampler::End(void) {
+
+	// Stop Sampler (running conversion result is dropped)
+	Running = false;
+	Busy = false;
+
+}
+
+// Timer Functions
+void Environment_Sampler::Tick(void) {
+
+	// Count Slot (single byte, read by Poll)
+	Ticks++;
+
+}
+
+// Run Functions
+void Environment_Sampler::Poll(void) {
+
+	// Control for Run
+	if (!Running) return;
+
+	// Run Asynchronous Queue
+	Sensor_Object->Poll();
+
+	// Collect Finished Conversion
+	if (Busy and Sensor_Object->Ready(Channel)) {
+
+		// Push Reading
+		Push(Start_Time, Sensor_Object->Reading(Channel).Value);
+
+		// Conversion Done
+		Busy = false;
+
+	}
+
+	// Get New Slots
+	uint8_t Slots_ = Slots();
+
+	// Control for Slot
+	if (Slots_ == 0) return;
+
+	// Slots While Converting Are Overruns
+	if (Busy) {
+
+		// Count Overruns
+		Overruns += Slots_;
+
+		// End Function
+		return;
+
+	}
+
+	// Missed Slots Are Overruns (only the last slot is sampled)
+	Overruns += Slots_ - 1;
+
+	// Start Conversion (forced, a fresh cached reading is not a new sample)
+	uint32_t Now_ = micros();
+	if (!Sensor_Object->Start(Channel, true)) {
+
+		// Count Overrun (device busy with another read)
+		Overruns++;
+
+		// End Function
+		return;
+
+	}
+
+	// Set Conversion
+	Busy = true;
+	Start_Time = Now_;
+
+	// Update Interval Statistics
+	if (Samples > 0) Interval(Now_ - Last_Start);
+	Last_Start = Now_;
+
+	// Count Sample
+	Samples++;
+
+}
+
+// Ring Functions
+bool Environment_Sampler::Read(Environment_Sample & Sample_) {
+
+	// Get Indexes (head published by producer after its record)
+	uint8_t Tail_ = Tail;
+	uint8_t Head_ = __atomic_load_n(&Head, __ATOMIC_ACQUIRE);
+
+	// Control for Empty Ring
+	if (Tail_ == Head_) return(false);
+
+	// Copy Record
+	Sample_ = Buffer[Tail_ & Mask];
+
+	// Release Slot to Producer
+	__atomic_store_n(&Tail, (uint8_t)(Tail_ + 1), __ATOMIC_RELEASE);
+
+	// End Function
+	return(true);
+
+}
+uint8_t Environment_Sampler::Available(void) {
+
+	// End Function
+	return((uint8_t)(__atomic_load_n(&Head, __ATOMIC_ACQUIRE) - __atomic_load_n(&Tail, __ATOMIC_ACQUIRE)));
+
+}
+
+// Statistic Functions
+uint32_t Environment_Sampler::Period(void) {
+
+	// End Function (mean interval)
+	return((uint32_t)(Interval_Mean + 0.5));
+
+}
+float Environment_Sampler::Jitter(void) {
+
+	// Control for Intervals
+	if (Interval_Count < 2) return(0);
+
+	// End Function (interval standard deviation)
+	return(sqrt(Interval_M2 / (Interval_Count - 1)));
+
+}
+uint32_t Environment_Sampler::Max_Jitter(void) {
+
+	// End Function (largest interval deviation from period)
+	return(Interval_Max);
+
+}
+uint32_t Environment_Sampler::Sample_Count(void) {
+
+	// End Function
+	return(Samples);
+
+}
+uint32_t Environment_Sampler::Overrun_Count(void) {
+
+	// End Function
+	return(Overruns);
+
+}
+uint32_t Environment_Sampler::Dropped_Count(void) {
+
+	// End Function
+	return(Dropped);
+
+}
+void Environment_Sampler::Reset_Statistics(void) {
+
+	// Clear Counters
+	Samples = 0;
+	Overruns = 0;
+	Dropped = 0;
+
+	// Clear Interval Statistics
+	Interval_Count = 0;
+	Interval_Mean = 0;
+	Interval_M2 = 0;
+	Interval_Max = 0;
+
+}
+
+// Private Functions
+uint8_t Environment_Sampler::Slots(void) {
+
+	// External Timer Slots
+	if (External) {
+
+		// Get Tick Counter (single byte read)
+		uint8_t Ticks_ = Ticks;
+
+		// Count New Ticks
+		uint8_t Slots_ = Ticks_ - Ticks_Seen;
+		Ticks_Seen = Ticks_;
+
+		// End Function
+		return(Slots_);
+
+	}
+
+	// Control for Due Slot (overflow safe)
+	uint32_t Now_ = micros();
+	if ((int32_t)(Now_ - Next_Due) < 0) return(0);
+
+	// Count Due Slots and Move to Next Slot on Grid
+	uint32_t Slots_ = (Now_ - Next_Due) / Sample_Period + 1;
+	Next_Due += Slots_ * Sample_Period;
+
+	// End Function
+	return((Slots_ > 255) ? 255 : (uint8_t)Slots_);
+
+}
+void Environment_Sampler::Push(const uint32_t Time_, const float Value_) {
+
+	// Get Indexes (tail released by consumer after its copy)
+	uint8_t Head_ = Head;
+	uint8_t Tail_ = __atomic_load_n(&Tail, __ATOMIC_ACQUIRE);
+
+	// Control for Full Ring
+	if ((uint8_t)(Head_ - Tail_) > Mask) {
+
+		// Count Dropped Sample
+		Dropped++;
+
+		// End Function
+		return;
+
+	}
+
+	// Write Record
+	Buffer[Head_ & Mask].Time = Time_;
+	Buffer[Head_ & Mask].Value = Value_;
+
+	// Publish Record to Consumer
+	__atomic_store_n(&Head, (uint8_t)(Head_ + 1), __ATOMIC_RELEASE);
+
+}
+void Environment_Sampler::Interval(const uint32_t Interval_) {
+
+	// Update Running Mean and Variance (Welford)
+	Interval_Count++;
+	float Delta_ = (float)Interval_ - Interval_Mean;
+	Interval_Mean += Delta_ / Interval_Count;
+	Interval_M2 += Delta_ * ((float)Interval_ - Interval_Mean);
+
+	// Update Largest Deviation From Period
+	uint32_t Deviation_ = (Interval_ > Sample_Period) ? Interval_ - Sample_Period : Sample_Period - Interval_;
+	if (Deviation_ > Interval_Max) Interval_Max = Deviation_;
+
+}
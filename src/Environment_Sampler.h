@@ -0,0 +1,132 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Fixed Rate Sampler.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Sampler__
+#define __Environment_Sampler__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// Define Environment Library
+#include "Environment.h"
+
+// ************************************************************
+// Sampler Operation
+// ************************************************************
+//
+//	Timer ISR	: Tick() counts a sample slot (one byte write, nothing else).
+//	Loop		: Poll() starts an asynchronous conversion for a new slot and
+//				  pushes finished conversions into the ring (producer).
+//	Application	: Read() drains the ring at its own pace (consumer).
+//
+//	Without an external timer Poll() makes its own slots on a fixed grid of
+//	micros, so late polls never shift later slots. A slot that comes while a
+//	conversion is still running is an overrun and is skipped.
+
+// Maximum Ring Size (power of two, 8 bit indexes)
+#define ENV_SAMPLER_MAX_SIZE		128
+
+// Sampler Record
+struct Environment_Sample {
+
+	uint32_t	Time;			// Conversion start (uS)
+	float		Value;			// Reading value or error code
+
+};
+
+class Environment_Sampler
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	// Ring Buffer Owned by Caller (Size_ is a power of two up to ENV_SAMPLER_MAX_SIZE)
+	Environment_Sampler(Environment_Sample * Buffer_, const uint8_t Size_, Environment & Sensor_ = Sensor);
+
+	// Sampler Control (period in uS, External_ when a timer ISR calls Tick)
+	bool Begin(const uint8_t Channel_, const uint32_t Period_, const bool External_ = false);
+	void End(void);
+
+	// Timer Tick (interrupt safe)
+	void Tick(void);
+
+	// Sampler Run (loop context, also runs the asynchronous queue)
+	void Poll(void);
+
+	// Ring Functions (consumer side)
+	bool Read(Environment_Sample & Sample_);
+	uint8_t Available(void);
+
+	// Interval Statistics (uS, between conversion starts)
+	uint32_t Period(void);
+	float Jitter(void);
+	uint32_t Max_Jitter(void);
+
+	// Counters
+	uint32_t Sample_Count(void);
+	uint32_t Overrun_Count(void);
+	uint32_t Dropped_Count(void);
+	void Reset_Statistics(void);
+
+private:
+
+	// ************************************************************
+	// Sampler Variables
+	// ************************************************************
+
+	// Sensor Object
+	Environment * Sensor_Object;
+
+	// Ring Buffer (Head written by producer, Tail by consumer)
+	Environment_Sample * Buffer;
+	uint8_t Mask;
+	volatile uint8_t Head;
+	volatile uint8_t Tail;
+
+	// Sampler Settings
+	uint8_t Channel;
+	uint32_t Sample_Period;
+	bool External;
+	bool Running;
+
+	// Slot Variables
+	volatile uint8_t Ticks;
+	uint8_t Ticks_Seen;
+	uint32_t Next_Due;
+
+	// Conversion Variables
+	bool Busy;
+	uint32_t Start_Time;
+	uint32_t Last_Start;
+
+	// Statistic Variables
+	uint32_t Samples;
+	uint32_t Overruns;
+	uint32_t Dropped;
+	uint32_t Interval_Count;
+	float Interval_Mean;
+	float Interval_M2;
+	uint32_t Interval_Max;
+
+	// ************************************************************
+	// Private Functions
+	// ************************************************************
+
+	uint8_t Slots(void);
+	void Push(const uint32_t Time_, const float Value_);
+	void Interval(const uint32_t Interval_);
+
+};
+
+#endif /* defined(__Environment_Sampler__) */
@@ -0,0 +1,254 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Duty Cycle Scheduler.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Scheduler.h"
+
+// Device Power Profiles (datasheet typical, order of ENV_SHT21 - ENV_TSL2561)
+const Environment_Power ENV_POWER_PROFILE[ENV_DEVICE_COUNT] PROGMEM = {
+	{300000,	150,	0},			// SHT21 : 300 uA measuring, 0.15 uA idle, supply never switched (15 ms power up not charged)
+	{550000,	50,		3000},		// HDC2010 : 550 uA converting, 0.05 uA sleep, 3 ms start up
+	{520000,	2000,	1000},		// MPL3115A2 : 520 uA converting (265 uA @ 1 Hz OS128), 2 uA standby, 1 ms boot
+	{240000,	3200,	0}			// TSL2561 : 240 uA active, 3.2 uA power down, integration starts at power up
+};
+
+Environment_Scheduler::Environment_Scheduler(Environment & Sensor_) {
+
+	// Set Sensor Object
+	Sensor_Object = &Sensor_;
+
+	// Set Supply Voltage
+	Supply_Voltage = ENV_SUPPLY_VOLTAGE;
+
+	// Clear Schedule
+	for (uint8_t i = 0; i < ENV_CHANNEL_COUNT; i++) {
+
+		// Clear Channel
+		Period[i] = ENV_SCHEDULE_NONE;
+		Next[i] = 0;
+		Read_Count[i] = 1;
+		Average_Type[i] = 1;
+		Reading_Energy[i] = 0;
+
+	}
+
+	// Clear Energy
+	Total_Energy = 0;
+	Last_Account = 0;
+
+}
+
+// Configuration Functions
+void Environment_Scheduler::Set_Supply_Voltage(const float Voltage_) {
+
+	// Set Voltage
+	Supply_Voltage = Voltage_;
+
+}
+bool Environment_Scheduler::Add(const uint8_t Channel_, const uint32_t Period_, const uint8_t Read_Count_, const uint8_t Average_Type_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT or Period_ == ENV_SCHEDULE_NONE) return(false);
+
+	// Start Energy Accounting With First Channel
+	if (Standby_Power() == 0) Last_Account = millis();
+
+	// Set Schedule (first reading is due now)
+	Period[Channel_] = Period_;
+	Next[Channel_] = millis();
+	Read_Count[Channel_] = Read_Count_;
+	Average_Type[Channel_] = Average_Type_;
+
+	// End Function
+	return(true);
+
+}
+void Environment_Scheduler::Remove(const uint8_t Channel_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return;
+
+	// Clear Schedule
+	Period[Channel_] = ENV_SCHEDULE_NONE;
+
+}
+
+// Scheduler Functions
+uint8_t Environment_Scheduler::Run(void) {
+
+	// Declare Variables
+	uint8_t Done_ = 0;
+	uint8_t Used_Device_ = 0;
+	uint32_t Now_ = millis();
+
+	// Account Standby Energy Since Last Run (uW * ms / 1000 = uJ)
+	Total_Energy += Standby_Power() * (float)(Now_ - Last_Account) / 1000;
+	Last_Account = Now_;
+
+	// Read Due Channels
+	for (uint8_t i = 0; i < ENV_CHANNEL_COUNT; i++) {
+
+		// Control for Schedule
+		if (Period[i] == ENV_SCHEDULE_NONE or (int32_t)(Now_ - Next[i]) < 0) continue;
+
+		// Read Channel
+		uint32_t Start_ = millis();
+		Sensor_Object->Read(i, Read_Count[i], Average_Type[i]);
+		uint32_t Duration_ = millis() - Start_;
+
+		// Get Reading
+		Environment_Reading Reading_ = Sensor_Object->Reading(i);
+
+		// Cached Reading Costs No Conversion
+		if ((int32_t)(Reading_.Time - Start_) < 0) Reading_Energy[i] = 0;
+		else Reading_Energy[i] = Reading_Estimate(i, (Reading_.Count == 0) ? 1 : Reading_.Count, Duration_);
+
+		// Account Reading Energy
+		Total_Energy += Reading_Energy[i];
+
+		// Mark Device
+		Used_Device_ |= (1 << Environment::Channel_Device(i));
+		Done_++;
+
+		// Set Next Reading (fixed rate, missed slots are skipped)
+		Next[i] += Period[i];
+		if ((int32_t)(Now_ - Next[i]) >= 0) Next[i] = Now_ + Period[i];
+
+	}
+
+	// Power Down Used Devices Until Next Reading
+	for (uint8_t i = 0; i < ENV_DEVICE_COUNT; i++) if (Used_Device_ & (1 << i)) Sensor_Object->Power_Down(i);
+
+	// End Function
+	return(Done_);
+
+}
+uint32_t Environment_Scheduler::Next_Due(void) {
+
+	// Declare Variables
+	uint32_t Wait_ = 0xFFFFFFFF;
+	uint32_t Now_ = millis();
+
+	// Find Nearest Reading
+	for (uint8_t i = 0; i < ENV_CHANNEL_COUNT; i++) {
+
+		// Control for Schedule
+		if (Period[i] == ENV_SCHEDULE_NONE) continue;
+
+		// Control for Due Channel
+		if ((int32_t)(Now_ - Next[i]) >= 0) return(0);
+
+		// Set Nearest
+		if (Next[i] - Now_ < Wait_) Wait_ = Next[i] - Now_;
+
+	}
+
+	// End Function
+	return(Wait_);
+
+}
+
+// Energy Functions
+float Environment_Scheduler::Energy_Per_Reading(const uint8_t Channel_) {
+
+	// Control for Channel
+	if (Channel_ >= ENV_CHANNEL_COUNT) return(0);
+
+	// End Function
+	return(Reading_Energy[Channel_]);
+
+}
+float Environment_Scheduler::Energy_Per_Hour(void) {
+
+	// Standby Energy (uW * 3600 s = uJ)
+	float Energy_ = Standby_Power() * 3600;
+
+	// Add Reading Energy
+	for (uint8_t i = 0; i < ENV_CHANNEL_COUNT; i++) {
+
+		// Control for Schedule
+		if (Period[i] == ENV_SCHEDULE_NONE) continue;
+
+		// Use Last Reading or Nominal Estimate
+		float Reading_ = (Reading_Energy[i] > 0) ? Reading_Energy[i] : Reading_Estimate(i, Read_Count[i], 0);
+
+		// Add Readings per Hour
+		Energy_ += Reading_ * (3600000.0 / (float)Period[i]);
+
+	}
+
+	// End Function (mJ)
+	return(Energy_ / 1000);
+
+}
+float Environment_Scheduler::Average_Current(void) {
+
+	// Control for Voltage
+	if (Supply_Voltage <= 0) return(0);
+
+	// End Function (mJ / 3600 s / V = mA, returned as uA)
+	return(Energy_Per_Hour() * 1000 / 3600 / Supply_Voltage);
+
+}
+float Environment_Scheduler::Energy_Total(void) {
+
+	// End Function (uJ)
+	return(Total_Energy + Standby_Power() * (float)(millis() - Last_Account) / 1000);
+
+}
+
+// Power Profile Functions
+Environment_Power Environment_Scheduler::Power_Profile(const uint8_t Device_) {
+
+	// Declare Variable
+	Environment_Power Profile_ = {0, 0, 0};
+
+	// Read Profile From Flash
+	if (Device_ < ENV_DEVICE_COUNT) memcpy_P(&Profile_, &ENV_POWER_PROFILE[Device_], sizeof(Environment_Power));
+
+	// End Function
+	return(Profile_);
+
+}
+
+// Private Functions
+float Environment_Scheduler::Reading_Estimate(const uint8_t Channel_, const uint8_t Count_, const uint32_t Duration_) {
+
+	// Get Power Profile
+	Environment_Power Profile_ = Power_Profile(Environment::Channel_Device(Channel_));
+
+	// Active Time (us, read time of channel resolution)
+	float Active_ = (float)Profile_.Wake_Latency + (float)Sensor_Object->Read_Time(Channel_, Count_);
+
+	// Wait Time Beyond Conversion is Spent in Standby (us)
+	float Idle_ = (float)Duration_ * 1000 - Active_;
+	if (Idle_ < 0) Idle_ = 0;
+
+	// End Function (nA * V * us = fJ, returned as uJ)
+	return(((float)Profile_.Active_Current * Active_ + (float)Profile_.Standby_Current * Idle_) * Supply_Voltage / 1000000000.0);
+
+}
+float Environment_Scheduler::Standby_Power(void) {
+
+	// Declare Variables
+	uint8_t Device_Mask_ = 0;
+	float Current_ = 0;
+
+	// Collect Scheduled Devices
+	for (uint8_t i = 0; i < ENV_CHANNEL_COUNT; i++) if (Period[i] != ENV_SCHEDULE_NONE) Device_Mask_ |= (1 << Environment::Channel_Device(i));
+
+	// Sum Standby Current (nA)
+	for (uint8_t i = 0; i < ENV_DEVICE_COUNT; i++) if (Device_Mask_ & (1 << i)) Current_ += Power_Profile(i).Standby_Current;
+
+	// End Function (nA * V / 1000 = uW)
+	return(Current_ * Supply_Voltage / 1000);
+
+}
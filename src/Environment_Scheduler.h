@@ -0,0 +1,94 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Duty Cycle Scheduler.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Scheduler__
+#define __Environment_Scheduler__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// Define Environment Library
+#include "Environment.h"
+
+// Scheduler Definations
+#define ENV_SUPPLY_VOLTAGE			3.3		// Default sensor supply voltage (V)
+#define ENV_SCHEDULE_NONE			0		// Channel is not scheduled
+
+// Device Power Profile (datasheet typical values)
+struct Environment_Power {
+
+	uint32_t	Active_Current;		// Supply current while converting (nA)
+	uint32_t	Standby_Current;	// Supply current in lowest power state (nA)
+	uint32_t	Wake_Latency;		// Wake up time before first conversion of every reading (us, 0 when the device idles powered)
+
+};
+
+class Environment_Scheduler
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Scheduler(Environment & Sensor_ = Sensor);
+
+	// Schedule Configuration
+	void Set_Supply_Voltage(const float Voltage_);
+	bool Add(const uint8_t Channel_, const uint32_t Period_, const uint8_t Read_Count_ = 1, const uint8_t Average_Type_ = 1);
+	void Remove(const uint8_t Channel_);
+
+	// Scheduler Functions
+	uint8_t Run(void);
+	uint32_t Next_Due(void);
+
+	// Energy Accounting
+	float Energy_Per_Reading(const uint8_t Channel_);
+	float Energy_Per_Hour(void);
+	float Average_Current(void);
+	float Energy_Total(void);
+
+	// Power Profile
+	static Environment_Power Power_Profile(const uint8_t Device_);
+
+private:
+
+	// ************************************************************
+	// Scheduler Variables
+	// ************************************************************
+
+	// Sensor Object
+	Environment * Sensor_Object;
+
+	// Supply Voltage
+	float Supply_Voltage;
+
+	// Channel Schedule
+	uint32_t Period[ENV_CHANNEL_COUNT];
+	uint32_t Next[ENV_CHANNEL_COUNT];
+	uint8_t Read_Count[ENV_CHANNEL_COUNT];
+	uint8_t Average_Type[ENV_CHANNEL_COUNT];
+
+	// Energy Variables (uJ)
+	float Reading_Energy[ENV_CHANNEL_COUNT];
+	float Total_Energy;
+
+	// Standby Accounting
+	uint32_t Last_Account;
+
+	// Energy Functions
+	float Reading_Estimate(const uint8_t Channel_, const uint8_t Count_, const uint32_t Duration_);
+	float Standby_Power(void);
+
+};
+
+#endif /* defined(__Environment_Scheduler__) */
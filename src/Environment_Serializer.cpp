@@ -0,0 +1,485 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Reading Serializer.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Serializer.h"
+
+// Channel Format Defination
+struct Environment_Channel_Format {
+
+	char		Name[20];		// Sensor function name
+	char		Unit[4];		// Value unit
+	uint8_t		Decimals;		// Fixed point decimals
+
+};
+
+// Channel Formats (ENV_CHANNEL_COUNT rows, channel ID order)
+static const Environment_Channel_Format ENV_CHANNEL_FORMAT[ENV_CHANNEL_COUNT] PROGMEM = {
+	{"SHT21_Temperature",	"C",	2},
+	{"SHT21_Humidity",		"%RH",	2},
+	{"HDC2010_Temperature",	"C",	2},
+	{"HDC2010_Humidity",	"%RH",	2},
+	{"MPL3115A2_Pressure",	"hPa",	2},
+	{"TSL2561_Light",		"lux",	0}
+};
+
+// Document Keys
+static const char ENV_KEY_VALUE[] PROGMEM = "value";
+static const char ENV_KEY_UNIT[] PROGMEM = "unit";
+static const char ENV_KEY_TIME[] PROGMEM = "time";
+static const char ENV_KEY_MIN[] PROGMEM = "min";
+static const char ENV_KEY_MAX[] PROGMEM = "max";
+static const char ENV_KEY_DEVIATION[] PROGMEM = "deviation";
+static const char ENV_KEY_COUNT[] PROGMEM = "count";
+static const char ENV_KEY_ERROR[] PROGMEM = "error";
+
+// Decimal Scales
+static const uint32_t ENV_DECIMAL_SCALE[] PROGMEM = {1, 10, 100, 1000, 10000};
+
+Environment_Serializer::Environment_Serializer(const uint8_t Format_, const bool Statistics_) {
+
+	// Set Settings
+	Format = Format_;
+	Statistics = Statistics_;
+
+	// Clear Sink
+	Buffer = NULL;
+	Output = NULL;
+	Position = 0;
+	Chunk_Length = 0;
+	First = true;
+
+}
+
+// Setting Functions
+void Environment_Serializer::Set_Format(const uint8_t Format_) {
+
+	// Set Format
+	Format = Format_;
+
+}
+void Environment_Serializer::Set_Statistics(const bool Statistics_) {
+
+	// Set Statistics
+	Statistics = Statistics_;
+
+}
+
+// Document Functions
+uint16_t Environment_Serializer::Length(const Environment_Reading * Reading_, const uint8_t Mask_) {
+
+	// Count Only
+	Buffer = NULL;
+	Output = NULL;
+
+	// Count Document
+	return(Document(Reading_, Mask_));
+
+}
+uint16_t Environment_Serializer::Write(const Environment_Reading * Reading_, uint8_t * Buffer_, const uint16_t Size_, const uint8_t Mask_) {
+
+	// Get Exact Length
+	uint16_t Length_ = Length(Reading_, Mask_);
+
+	// Control for Buffer Size (nothing is written to a short buffer)
+	if (Buffer_ == NULL or Length_ > Size_) return(0);
+
+	// Write Document
+	Buffer = Buffer_;
+	Document(Reading_, Mask_);
+	Buffer = NULL;
+
+	// Terminate JSON Text When Buffer Has a Spare Byte
+	if (Format == ENV_FORMAT_JSON and Length_ < Size_) Buffer_[Length_] = 0;
+
+	// End Function
+	return(Length_);
+
+}
+uint16_t Environment_Serializer::Write(const Environment_Reading * Reading_, Environment_Serializer_Output Output_, const uint8_t Mask_) {
+
+	// Control for Output
+	if (Output_ == NULL) return(0);
+
+	// Stream Document
+	Buffer = NULL;
+	Output = Output_;
+	uint16_t Length_ = Document(Reading_, Mask_);
+
+	// Send Last Chunk
+	Flush();
+	Output = NULL;
+
+	// End Function
+	return(Length_);
+
+}
+
+// Private Document Functions
+uint16_t Environment_Serializer::Document(const Environment_Reading * Reading_, const uint8_t Mask_) {
+
+	// Clear Sink
+	Position = 0;
+	Chunk_Length = 0;
+
+	// Control for Readings
+	if (Reading_ == NULL) return(0);
+
+	// Declare Entry Mask (selected channels with a reading or an error)
+	uint8_t Entry_Mask_ = 0;
+	uint8_t Entry_Count_ = 0;
+
+	// Select Entries
+	for (uint8_t i = 0; i < ENV_CHANNEL_COUNT; i++) {
+
+		// Control for Selection
+		if ((Mask_ & (1 << i)) == 0) continue;
+
+		// Control for Never Read Channel
+		if (Reading_[i].Count == 0 and Reading_[i].Error == 0) continue;
+
+		// Set Entry
+		Entry_Mask_ |= (1 << i);
+		Entry_Count_++;
+
+	}
+
+	// Open Document
+	Begin_Map(Entry_Count_);
+
+	// Write Entries
+	for (uint8_t i = 0; i < ENV_CHANNEL_COUNT; i++) if (Entry_Mask_ & (1 << i)) Entry(i, Reading_[i]);
+
+	// Close Document
+	End_Map();
+
+	// End Function
+	return(Position);
+
+}
+void Environment_Serializer::Entry(const uint8_t Channel_, const Environment_Reading & Reading_) {
+
+	// Get Channel Format
+	const Environment_Channel_Format * Channel_Format_ = &ENV_CHANNEL_FORMAT[Channel_];
+	uint8_t Decimals_ = pgm_read_byte(&Channel_Format_->Decimals);
+
+	// Statistics Only for Successful Readings
+	bool Statistics_ = (Statistics and Reading_.Error == 0);
+
+	// Open Channel
+	Key(Channel_Format_->Name);
+	Begin_Map(Statistics_ ? 8 : 4);
+
+	// Write Value (null on error)
+	Key(ENV_KEY_VALUE);
+	if (Reading_.Error == 0) Number(Reading_.Value, Decimals_); else Null();
+
+	// Write Unit and Time
+	Key(ENV_KEY_UNIT);
+	Text(Channel_Format_->Unit);
+	Key(ENV_KEY_TIME);
+	Unsigned(Reading_.Time);
+
+	// Write Statistics
+	if (Statistics_) {
+
+		// Write Limits
+		Key(ENV_KEY_MIN);
+		Number(Reading_.Min, Decimals_);
+		Key(ENV_KEY_MAX);
+		Number(Reading_.Max, Decimals_);
+
+		// Write Deviation (one more decimal)
+		Key(ENV_KEY_DEVIATION);
+		Number(Reading_.Deviation, Decimals_ + 1);
+
+		// Write Count
+		Key(ENV_KEY_COUNT);
+		Integer(Reading_.Count);
+
+	}
+
+	// Write Error
+	Key(ENV_KEY_ERROR);
+	Integer(Reading_.Error);
+
+	// Close Channel
+	End_Map();
+
+}
+
+// Private Element Functions
+void Environment_Serializer::Begin_Map(const uint8_t Count_) {
+
+	// Open Map
+	if (Format == ENV_FORMAT_JSON) Put('{'); else Head(5, Count_);
+
+	// First Member Has No Separator
+	First = true;
+
+}
+void Environment_Serializer::End_Map(void) {
+
+	// Close Map (CBOR map is counted)
+	if (Format == ENV_FORMAT_JSON) Put('}');
+
+	// Map is a Member of Parent
+	First = false;
+
+}
+void Environment_Serializer::Key(const char * Key_) {
+
+	// Write Member Separator
+	if (Format == ENV_FORMAT_JSON and not First) Put(',');
+
+	// Write Key
+	Text(Key_);
+
+	// Write Key Separator
+	if (Format == ENV_FORMAT_JSON) Put(':');
+
+	// Value Follows
+	First = true;
+
+}
+void Environment_Serializer::Text(const char * Text_) {
+
+	// Get Text Length (flash string, plain ASCII without escapes)
+	uint8_t Length_ = 0;
+	while (pgm_read_byte(Text_ + Length_) != 0) Length_++;
+
+	// Write Text Head
+	if (Format == ENV_FORMAT_JSON) Put('"'); else Head(3, Length_);
+
+	// Write Characters
+	for (uint8_t i = 0; i < Length_; i++) Put(pgm_read_byte(Text_ + i));
+
+	// Write Text End
+	if (Format == ENV_FORMAT_JSON) Put('"');
+
+	// Member Written
+	First = false;
+
+}
+void Environment_Serializer::Number(const float Value_, const uint8_t Decimals_) {
+
+	// Get Decimal Scale
+	uint32_t Scale_ = pgm_read_dword(&ENV_DECIMAL_SCALE[Decimals_]);
+
+	// Scale Value
+	float Scaled_ = Value_ * (float)Scale_;
+
+	// Control for Range (NaN and infinity fail both tests)
+	if (not (Scaled_ > -2000000000.0 and Scaled_ < 2000000000.0)) {
+
+		// Write Null
+		Null();
+
+		// End Function
+		return;
+
+	}
+
+	// Round to Fixed Point
+	int32_t Fixed_ = (int32_t)(Scaled_ < 0 ? Scaled_ - 0.5 : Scaled_ + 0.5);
+
+	// CBOR Value
+	if (Format == ENV_FORMAT_CBOR) {
+
+		// Control for Integer Channel
+		if (Decimals_ == 0) {
+
+			// Write Integer
+			Integer(Fixed_);
+
+			// End Function
+			return;
+
+		}
+
+		// Write Decimal Fraction (tag 4, [exponent, mantissa])
+		Head(6, 4);
+		Head(4, 2);
+		Integer(-(int32_t)Decimals_);
+		Integer(Fixed_);
+
+		// End Function
+		return;
+
+	}
+
+	// Write Sign
+	if (Fixed_ < 0) Put('-');
+
+	// Get Magnitude
+	uint32_t Magnitude_ = (Fixed_ < 0) ? (uint32_t)(-Fixed_) : (uint32_t)Fixed_;
+
+	// Write Integer Part
+	Digits(Magnitude_ / Scale_, 1);
+
+	// Write Fraction Part
+	if (Decimals_ > 0) {
+
+		// Write Decimal Point
+		Put('.');
+
+		// Write Fraction With Leading Zeros
+		Digits(Magnitude_ % Scale_, Decimals_);
+
+	}
+
+	// Member Written
+	First = false;
+
+}
+void Environment_Serializer::Integer(const int32_t Value_) {
+
+	// CBOR Integer (negative is major type 1 with -1 - value)
+	if (Format == ENV_FORMAT_CBOR) {
+
+		// Write Integer
+		if (Value_ < 0) Head(1, (uint32_t)(-1 - Value_)); else Head(0, (uint32_t)Value_);
+
+		// End Function
+		return;
+
+	}
+
+	// Write Sign
+	if (Value_ < 0) Put('-');
+
+	// Write Digits
+	Digits((Value_ < 0) ? (uint32_t)(-(Value_ + 1)) + 1 : (uint32_t)Value_, 1);
+
+	// Member Written
+	First = false;
+
+}
+void Environment_Serializer::Unsigned(const uint32_t Value_) {
+
+	// Write Integer
+	if (Format == ENV_FORMAT_JSON) Digits(Value_, 1); else Head(0, Value_);
+
+	// Member Written
+	First = false;
+
+}
+void Environment_Serializer::Null(void) {
+
+	// Write Null
+	if (Format == ENV_FORMAT_JSON) {
+
+		// Write Text
+		Put('n'); Put('u'); Put('l'); Put('l');
+
+	} else {
+
+		// Write Simple Value 22
+		Put(0xF6);
+
+	}
+
+	// Member Written
+	First = false;
+
+}
+
+// Private Encoding Functions
+void Environment_Serializer::Put(const uint8_t Byte_) {
+
+	// Buffer Sink
+	if (Buffer != NULL) {
+
+		// Set Byte
+		Buffer[Position] = Byte_;
+
+	} else if (Output != NULL) {
+
+		// Collect Byte
+		Chunk[Chunk_Length++] = Byte_;
+
+		// Send Full Chunk
+		if (Chunk_Length == ENV_SERIALIZER_CHUNK) Flush();
+
+	}
+
+	// Count Byte
+	Position++;
+
+}
+void Environment_Serializer::Digits(uint32_t Value_, const uint8_t Width_) {
+
+	// Declare Digit Buffer (uint32 has at most 10 digits)
+	uint8_t Digit_[10];
+	uint8_t Count_ = 0;
+
+	// Split Digits (least significant first)
+	do {
+
+		// Set Digit
+		Digit_[Count_++] = (uint8_t)(Value_ % 10);
+		Value_ /= 10;
+
+	} while (Value_ > 0 and Count_ < 10);
+
+	// Write Leading Zeros
+	for (uint8_t i = Count_; i < Width_; i++) Put('0');
+
+	// Write Digits
+	while (Count_ > 0) Put('0' + Digit_[--Count_]);
+
+}
+void Environment_Serializer::Head(const uint8_t Major_, const uint32_t Value_) {
+
+	// Set Major Type
+	uint8_t Type_ = (uint8_t)(Major_ << 5);
+
+	// Write Head With Shortest Argument
+	if (Value_ < 24) {
+
+		// Argument in Head
+		Put(Type_ | (uint8_t)Value_);
+
+	} else if (Value_ <= 0xFF) {
+
+		// One Byte Argument
+		Put(Type_ | 24);
+		Put((uint8_t)Value_);
+
+	} else if (Value_ <= 0xFFFF) {
+
+		// Two Byte Argument
+		Put(Type_ | 25);
+		Put((uint8_t)(Value_ >> 8));
+		Put((uint8_t)Value_);
+
+	} else {
+
+		// Four Byte Argument
+		Put(Type_ | 26);
+		Put((uint8_t)(Value_ >> 24));
+		Put((uint8_t)(Value_ >> 16));
+		Put((uint8_t)(Value_ >> 8));
+		Put((uint8_t)Value_);
+
+	}
+
+}
+void Environment_Serializer::Flush(void) {
+
+	// Control for Chunk
+	if (Output == NULL or Chunk_Length == 0) return;
+
+	// Send Chunk
+	Output(Chunk, Chunk_Length);
+	Chunk_Length = 0;
+
+}
@@ -0,0 +1,113 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Reading Serializer.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Serializer__
+#define __Environment_Serializer__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+#include "Environment_Reading.h"
+
+// ************************************************************
+// Document Format
+// ************************************************************
+//
+//	One map entry per channel with a reading, keyed by function name:
+//
+//	{"SHT21_Temperature":{"value":24.32,"unit":"C","time":1520,"min":24.30,
+//	 "max":24.35,"deviation":0.018,"count":10,"error":0}, ...}
+//
+//	- Values are fixed point with channel decimals (deviation one more).
+//	- Error readings have a null value and no statistics.
+//	- CBOR uses the same keys, decimal fractions (tag 4) for values and
+//	  integers for channels without decimals.
+
+// Output Formats
+#define ENV_FORMAT_JSON				0
+#define ENV_FORMAT_CBOR				1
+
+// All Channels Mask
+#define ENV_CHANNEL_ALL				0x3F
+
+// Sink Chunk Size (bytes collected before each output call)
+#ifndef ENV_SERIALIZER_CHUNK
+#define ENV_SERIALIZER_CHUNK		16
+#endif
+
+// Serializer Output (called for every full chunk and at document end)
+typedef void (*Environment_Serializer_Output)(const uint8_t * Data_, const uint16_t Length_);
+
+class Environment_Serializer
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Serializer(const uint8_t Format_ = ENV_FORMAT_JSON, const bool Statistics_ = true);
+
+	// Serializer Settings
+	void Set_Format(const uint8_t Format_);
+	void Set_Statistics(const bool Statistics_);
+
+	// Document Functions (Reading_ holds ENV_CHANNEL_COUNT readings, Mask_ selects channels)
+	uint16_t Length(const Environment_Reading * Reading_, const uint8_t Mask_ = ENV_CHANNEL_ALL);
+	uint16_t Write(const Environment_Reading * Reading_, uint8_t * Buffer_, const uint16_t Size_, const uint8_t Mask_ = ENV_CHANNEL_ALL);
+	uint16_t Write(const Environment_Reading * Reading_, Environment_Serializer_Output Output_, const uint8_t Mask_ = ENV_CHANNEL_ALL);
+
+private:
+
+	// ************************************************************
+	// Serializer Variables
+	// ************************************************************
+
+	// Settings
+	uint8_t Format;
+	bool Statistics;
+
+	// Document Sink (no buffer and no output only counts)
+	uint8_t * Buffer;
+	Environment_Serializer_Output Output;
+	uint16_t Position;
+	uint8_t Chunk[ENV_SERIALIZER_CHUNK];
+	uint8_t Chunk_Length;
+	bool First;
+
+	// ************************************************************
+	// Private Functions
+	// ************************************************************
+
+	// Document Functions
+	uint16_t Document(const Environment_Reading * Reading_, const uint8_t Mask_);
+	void Entry(const uint8_t Channel_, const Environment_Reading & Reading_);
+
+	// Element Functions
+	void Begin_Map(const uint8_t Count_);
+	void End_Map(void);
+	void Key(const char * Key_);
+	void Text(const char * Text_);
+	void Number(const float Value_, const uint8_t Decimals_);
+	void Integer(const int32_t Value_);
+	void Unsigned(const uint32_t Value_);
+	void Null(void);
+
+	// Encoding Functions
+	void Put(const uint8_t Byte_);
+	void Digits(uint32_t Value_, const uint8_t Width_);
+	void Head(const uint8_t Major_, const uint32_t Value_);
+	void Flush(void);
+
+};
+
+#endif /* defined(__Environment_Serializer__) */
@@ -0,0 +1,39 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Storage Interface.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Storage__
+#define __Environment_Storage__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// Page Oriented Non Volatile Region of a Platform
+class Environment_Storage
+{
+public:
+
+	// Region Geometry
+	virtual uint16_t Page_Count(void) = 0;
+	virtual uint16_t Page_Size(void) = 0;
+
+	// Read Bytes of a Page
+	virtual bool Read(const uint16_t Page_, const uint16_t Offset_, uint8_t * Data_, const uint16_t Length_) = 0;
+
+	// Replace Whole Page (erase if the medium needs it)
+	virtual bool Write(const uint16_t Page_, const uint8_t * Data_) = 0;
+
+	// Make Written Pages Durable
+	virtual bool Sync(void) { return(true); }
+
+};
+
+#endif /* defined(__Environment_Storage__) */
@@ -0,0 +1,376 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - TSL2561 Driver.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_TSL2561.h"
+
+Environment_TSL2561::Environment_TSL2561(Environment_Bus & Bus_, const uint8_t Address_) : Environment_Driver(Bus_, Address_, ENV_TSL2561_MAX_CLOCK) {
+
+}
+
+// Start Functions
+bool Environment_TSL2561::Begin(void) {
+
+	// Set Start Time
+	Start_Begin();
+
+	// Start Bus Session
+	Environment_Bus_Session Session_(*Bus, Device);
+
+	// Read Device ID Register
+	uint8_t TSL2561_Device_ID = 0x00;
+	if (Bus->Read_Register(Device, 0b10001010, &TSL2561_Device_ID, 1) != 0) return(Start_End(ENV_START_NONE));
+
+	// Control for Device ID
+	if (TSL2561_Device_ID != 0b01010000 and TSL2561_Device_ID != 0b11111111) return(Start_End(ENV_START_NONE));
+
+	// Read Timing Register
+	uint8_t TSL2561_Timing_Register = 0x00;
+	if (Bus->Read_Register(Device, 0b10000001, &TSL2561_Timing_Register, 1) != 0) return(Start_End(ENV_START_NONE));
+
+	// Control for Light Settings (13.7 ms integration, high gain)
+	if ((TSL2561_Timing_Register & 0b00010011) == 0b00010000) return(Start_End(ENV_START_WARM));
+
+	// Write Timing Register
+	if (Bus->Write_Register(Device, 0b10000001, (TSL2561_Timing_Register & 0b11101100) | 0b00010000) != 0) return(Start_End(ENV_START_NONE));
+
+	// Delay
+	Bus->Delay(50);
+
+	// End Function
+	return(Start_End(ENV_START_COLD));
+
+}
+
+// Measurement Functions
+float Environment_TSL2561::Light(void) {
+
+	// Measure (failed read clears configuration)
+	return(Result(Measure()));
+
+}
+float Environment_TSL2561::Measure(void) {
+	
+	/******************************************************************************
+	 *	Project		: TSL2561 Light Read Function
+	 *	Developer	: Mehmet Gunce Akkoyun (akkoyun@me.com)
+	 *	Revision	: 04.00.00
+	 *	Release		: 04.11.2020
+	 ******************************************************************************/
+	
+	// Define Sensor Settings
+	int TSL2561_Integrate_Time 	= 1; // 13.7 ms - 0.034 Scale
+	int TSL2561_Gain 			= 1; // 1x Gain
+	
+	// Declare Output Variable
+	float Value_;
+
+	// Start Bus Session (device clock, restored on return)
+	Environment_Bus_Session Session_(*Bus, Device);
+
+	/****************************************
+	 * Read Device ID Register from TSL2561
+	 ****************************************/
+	
+	// Read Device ID Register (skipped when registers are known)
+	uint8_t TSL2561_Device_ID = 0x00;
+	if (!Configured) Bus->Read_Register(Device, 0b10001010, &TSL2561_Device_ID, 1); // 0x80 | 0x0A
+	
+	// 0b0000xxxx = TSL2560
+	// 0b0001xxxx = TSL2561
+	
+	// Control for Device ID
+	if (Configured or TSL2561_Device_ID == 0b01010000 or TSL2561_Device_ID == 0b11111111) {
+		
+		// Set Timing Unless Registers are Known
+		if (!Configured) {
+
+			/****************************************
+			 * Read Timing Register from TSL2561
+			 ****************************************/
+		
+			// Read Timing Register
+			uint8_t TSL2561_Timing_Register = 0x00;
+			Bus->Read_Register(Device, 0b10000001, &TSL2561_Timing_Register, 1); // 0x80 | 0x01
+		
+			/****************************************
+			 * Set Timing & Gain bits
+			 ****************************************/
+		
+			// Set Integrate Time Bit Values
+			if (TSL2561_Integrate_Time == 1) {
+			
+				// Set Bit 0 LOW
+				TSL2561_Timing_Register &= 0b11111110;
+			
+				// Set Bit 1 LOW
+				TSL2561_Timing_Register &= 0b11111101;
+			
+			} // 0.034 Scale - 13.7 ms
+			if (TSL2561_Integrate_Time == 2) {
+			
+				// Set Bit 0 HIGH
+				TSL2561_Timing_Register |= 0b00000001;
+			
+				// Set Bit 1 LOW
+				TSL2561_Timing_Register &= 0b11111101;
+			
+			} // 0.252 Scale - 101 ms
+			if (TSL2561_Integrate_Time == 3) {
+			
+				// Set Bit 0 LOW
+				TSL2561_Timing_Register &= 0b11111110;
+			
+				// Set Bit 1 HIGH
+				TSL2561_Timing_Register |= 0b00000010;
+			
+			} // 1.000 Scale - 402 ms
+		
+			// Set Gain Bit Values
+			if (TSL2561_Gain == 0) {
+			
+				// Set Bit 4 LOW
+				TSL2561_Timing_Register &= 0b11101111;
+			
+			} // 0 - Low Gain (1x)
+			if (TSL2561_Gain == 1) {
+			
+				// Set Bit 4 HIGH
+				TSL2561_Timing_Register |= 0b00010000;
+			
+			} // 1 - High Gain (16x)
+		
+			/****************************************
+			 * Write Timing Register to TSL2561
+			 ****************************************/
+		
+			// Write Timing Register
+			uint8_t TSL2561_Timing_Register_Write = Bus->Write_Register(Device, 0b10000001, TSL2561_Timing_Register); // 0x80 | 0x01
+		
+			// Control For Register Write
+			if (TSL2561_Timing_Register_Write != 0) return(-101);
+		
+			// Delay
+			Bus->Delay(50);
+
+		}
+
+		/****************************************
+		 * Power ON TSL2561
+		 ****************************************/
+		
+		// Set Power On Register
+		uint8_t TSL2561_Power_ON_Register_Write = Bus->Write_Register(Device, 0b10000000, 0b00000011); // 0x80 | 0x00 - 0x03
+		
+		// Control For Register Write
+		if (TSL2561_Power_ON_Register_Write != 0) return(-102);
+		
+		/****************************************
+		 * Read CH0
+		 ****************************************/
+		
+		// Read DATA0LOW Register
+		uint8_t TSL2561_CH0_LSB = 0x00;
+		Bus->Read_Register(Device, 0b10001100, &TSL2561_CH0_LSB, 1);
+		
+		// Read DATA0HIGH Register
+		uint8_t TSL2561_CH0_MSB = 0x00;
+		Bus->Read_Register(Device, 0b10001101, &TSL2561_CH0_MSB, 1);
+		
+		// Combine Read Bytes
+		uint16_t TSL2561_CH0 = (TSL2561_CH0_MSB << 8) | TSL2561_CH0_LSB;
+		
+		/****************************************
+		 * Read CH1
+		 ****************************************/
+		
+		// Read DATA1LOW Register
+		uint8_t TSL2561_CH1_LSB = 0x00;
+		Bus->Read_Register(Device, 0b10001110, &TSL2561_CH1_LSB, 1);
+		
+		// Read DATA1HIGH Register
+		uint8_t TSL2561_CH1_MSB = 0x00;
+		Bus->Read_Register(Device, 0b10001111, &TSL2561_CH1_MSB, 1);
+		
+		// Combine Read Bytes
+		uint16_t TSL2561_CH1 = (TSL2561_CH1_MSB << 8) | TSL2561_CH1_LSB;
+		
+		/****************************************
+		 * Calculate LUX
+		 ****************************************/
+		
+		// Calculate Lux From Channel Counts
+		Value_ = Lux(TSL2561_CH0, TSL2561_CH1, TSL2561_Integrate_Time, TSL2561_Gain);
+		
+		/****************************************
+		 * Read Delay
+		 ****************************************/
+		
+		// Delay
+		if (TSL2561_Integrate_Time == 1) Bus->Delay(14);
+		if (TSL2561_Integrate_Time == 2) Bus->Delay(102);
+		if (TSL2561_Integrate_Time == 3) Bus->Delay(403);
+		
+		/****************************************
+		 * Power OFF TSL2561
+		 ****************************************/
+		
+		// Set Power Off Register
+		uint8_t TSL2561_Power_OFF_Register_Write = Bus->Write_Register(Device, 0b10000000, 0b00000000); // 0x80 | 0x00 - 0x00
+		
+		// Control For Register Write
+		if (TSL2561_Power_OFF_Register_Write != 0) return(-103);
+		
+		// Power Off Delay
+		Bus->Delay(50);
+
+	}
+	else {
+		
+		// End Function
+		return(-104);
+		
+	}
+	
+	// End Function
+	return(Value_);
+	
+}
+
+// Power Functions
+uint8_t Environment_TSL2561::Power_Down(void) {
+
+	// Start Bus Session
+	Environment_Bus_Session Session_(*Bus, Device);
+
+	// Power Off Control Register
+	return(Bus->Write_Register(Device, 0b10000000, 0b00000000));
+
+}
+
+// Lux Functions
+float Environment_TSL2561::Lux(const uint16_t CH0_, const uint16_t CH1_, const uint8_t Integrate_Time_, const uint8_t Gain_) {
+
+	/****************************************
+	 * Normalize Data
+	 ****************************************/
+	
+	uint32_t TSL2561_Channel_Scale; 	// chScale
+	uint32_t TSL2561_Channel_1;		// channel1
+	uint32_t TSL2561_Channel_0;		// channel0
+	
+	// Scale for Integration Time
+	switch (Integrate_Time_) {
+			
+		case 1:
+			
+			TSL2561_Channel_Scale = 0x7517;
+			break;
+			
+		case 2:
+			
+			TSL2561_Channel_Scale = 0x0FE7;
+			break;
+			
+		case 3:
+			
+			TSL2561_Channel_Scale = (1 << 10);
+			break;
+			
+		default:
+			break;
+	}
+	
+	// Scale for Gain
+	if (Gain_ == 1) TSL2561_Channel_Scale = TSL2561_Channel_Scale;
+	if (Gain_ == 2) TSL2561_Channel_Scale = TSL2561_Channel_Scale << 4;
+	
+	// Scale Channel Values
+	TSL2561_Channel_0 = (CH0_ * TSL2561_Channel_Scale) >> 10;
+	TSL2561_Channel_1 = (CH1_ * TSL2561_Channel_Scale) >> 10;
+	
+	/****************************************
+	 * Calculate LUX
+	 ****************************************/
+	
+	// Find the Ratio of the Channel Values (Channel1/Channel0)
+	uint32_t TSL2561_Channel_Ratio = 0;
+	if (TSL2561_Channel_0 != 0) TSL2561_Channel_Ratio = (TSL2561_Channel_1 << 10) / TSL2561_Channel_0;
+	
+	// Round the Ratio Value
+	uint32_t TSL2561_Ratio = (TSL2561_Channel_Ratio + 1) >> 1;
+	
+	unsigned int TSL2561_Calculation_B, TSL2561_Calculation_M;
+	
+	if ((TSL2561_Ratio >= 0) && (TSL2561_Ratio <= 0x0040)) {
+		
+		TSL2561_Calculation_B = 0x01F2;
+		TSL2561_Calculation_M = 0x01BE;
+		
+	}
+	else if (TSL2561_Ratio <= 0x0080) {
+		
+		TSL2561_Calculation_B = 0x0214;
+		TSL2561_Calculation_M = 0x02D1;
+		
+	}
+	else if (TSL2561_Ratio <= 0x00C0) {
+		
+		TSL2561_Calculation_B = 0x023F;
+		TSL2561_Calculation_M = 0x037B;
+		
+	}
+	else if (TSL2561_Ratio <= 0x0100) {
+		
+		TSL2561_Calculation_B = 0x0270;
+		TSL2561_Calculation_M = 0x03FE;
+		
+	}
+	else if (TSL2561_Ratio <= 0x0138) {
+		
+		TSL2561_Calculation_B = 0x016F;
+		TSL2561_Calculation_M = 0x01FC;
+		
+	}
+	else if (TSL2561_Ratio <= 0x019A) {
+		
+		TSL2561_Calculation_B = 0x00D2;
+		TSL2561_Calculation_M = 0x00FB;
+		
+	}
+	else if (TSL2561_Ratio <= 0x029A) {
+		
+		TSL2561_Calculation_B = 0x0018;
+		TSL2561_Calculation_M = 0x0012;
+		
+	}
+	else if (TSL2561_Ratio > 0x029A) {
+		
+		TSL2561_Calculation_B = 0x0000;
+		TSL2561_Calculation_M = 0x0000;
+		
+	}
+	
+	uint32_t TSL2561_Lux_Temp;
+	
+	// Calculate Temp Lux Value
+	TSL2561_Lux_Temp = ((TSL2561_Channel_0 * TSL2561_Calculation_B) - (TSL2561_Channel_1 * TSL2561_Calculation_M));
+	
+	// Do not Allow Negative Lux Value
+	if (TSL2561_Lux_Temp < 0) TSL2561_Lux_Temp = 0;
+	
+	// Round LSB (2^(LUX_SCALE-1))
+	TSL2561_Lux_Temp += (1 << 13);
+	
+	// Strip Off Fractional Portion (end function)
+	return(TSL2561_Lux_Temp >> 14);
+
+}
@@ -0,0 +1,57 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - TSL2561 Driver.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_TSL2561__
+#define __Environment_TSL2561__
+
+// Define Driver Base
+#include "Environment_Driver.h"
+
+// Device Address and Clock
+#define ENV_TSL2561_ADDRESS			0x39	// ADDR SEL floating
+#define ENV_TSL2561_ADDRESS_LOW		0x29	// ADDR SEL low
+#define ENV_TSL2561_ADDRESS_HIGH	0x49	// ADDR SEL high
+#define ENV_TSL2561_MAX_CLOCK		400000
+
+class Environment_TSL2561 : public Environment_Driver
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_TSL2561(Environment_Bus & Bus_, const uint8_t Address_ = ENV_TSL2561_ADDRESS);
+
+	// Warm Start (skips timing setup when registers are intact)
+	bool Begin(void);
+
+	// Measurements
+	float Light(void);
+
+	// Power Management
+	uint8_t Power_Down(void);
+
+	// Lux From Channel Counts
+	static float Lux(const uint16_t CH0_, const uint16_t CH1_, const uint8_t Integrate_Time_, const uint8_t Gain_);
+
+private:
+
+	// ************************************************************
+	// Private Functions
+	// ************************************************************
+
+	float Measure(void);
+
+};
+
+#endif /* defined(__Environment_TSL2561__) */
@@ -0,0 +1,608 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Bus Trace Record and Replay.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Trace.h"
+
+// Trace Header
+static const uint8_t ENV_TRACE_MAGIC[ENV_TRACE_HEADER_SIZE] = {'E', 'N', 'V', 'T', ENV_TRACE_VERSION};
+
+// ************************************************************
+// Recorder
+// ************************************************************
+
+Environment_Recorder::Environment_Recorder(Environment_Transport & Target_, uint8_t * Buffer_, const uint16_t Size_, Environment_Trace_Output Output_) {
+
+	// Set Target Transport
+	Target = &Target_;
+
+	// Set Record Buffer
+	Buffer = Buffer_;
+	Buffer_Size = Size_;
+	Position = 0;
+	Output = Output_;
+
+	// Not Recording
+	Recording = false;
+	Overflowed = false;
+	Last_Time = 0;
+	Records = 0;
+	Bytes = 0;
+
+}
+
+// Record Control Functions
+void Environment_Recorder::Start(void) {
+
+	// Clear Trace
+	Position = 0;
+	Records = 0;
+	Bytes = 0;
+	Overflowed = false;
+
+	// Start Recording
+	Recording = true;
+	Last_Time = micros();
+
+	// Write Header
+	for (uint8_t i = 0; i < ENV_TRACE_HEADER_SIZE; i++) Put(ENV_TRACE_MAGIC[i]);
+
+}
+void Environment_Recorder::Stop(void) {
+
+	// Send Remaining Records
+	Flush();
+
+	// Stop Recording
+	Recording = false;
+
+}
+void Environment_Recorder::Flush(void) {
+
+	// Control for Output (without output the trace stays in the buffer)
+	if (Output == NULL or Position == 0) return;
+
+	// Send Buffer
+	Output(Buffer, Position);
+	Position = 0;
+
+}
+
+// Record Status Functions
+uint32_t Environment_Recorder::Record_Count(void) {
+
+	// End Function
+	return(Records);
+
+}
+uint32_t Environment_Recorder::Trace_Size(void) {
+
+	// End Function
+	return(Bytes);
+
+}
+bool Environment_Recorder::Overflow(void) {
+
+	// End Function (recording stopped on a full buffer without output)
+	return(Overflowed);
+
+}
+
+// Transaction Functions
+uint8_t Environment_Recorder::Write(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_) {
+
+	// Run Transaction
+	uint32_t Time_ = micros();
+	uint8_t Result_ = Target->Write(Address_, Data_, Length_);
+
+	// Record Transaction
+	Record(ENV_TRACE_WRITE, Result_, Time_);
+	Put(Address_);
+	Put_Data(Data_, Length_);
+
+	// End Function
+	return(Result_);
+
+}
+uint8_t Environment_Recorder::Read(const uint8_t Address_, uint8_t * Data_, const uint8_t Length_) {
+
+	// Run Transaction
+	uint32_t Time_ = micros();
+	uint8_t Result_ = Target->Read(Address_, Data_, Length_);
+
+	// Record Transaction
+	Record(ENV_TRACE_READ, Result_, Time_);
+	Put(Address_);
+	Put_Data(Data_, Length_);
+
+	// End Function
+	return(Result_);
+
+}
+uint8_t Environment_Recorder::Write_Read(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_, uint8_t * Read_Data_, const uint8_t Read_Length_) {
+
+	// Run Transaction
+	uint32_t Time_ = micros();
+	uint8_t Result_ = Target->Write_Read(Address_, Data_, Length_, Read_Data_, Read_Length_);
+
+	// Record Transaction
+	Record(ENV_TRACE_WRITE_READ, Result_, Time_);
+	Put(Address_);
+	Put_Data(Data_, Length_);
+	Put_Data(Read_Data_, Read_Length_);
+
+	// End Function
+	return(Result_);
+
+}
+void Environment_Recorder::Set_Clock(const uint32_t Clock_) {
+
+	// Set Clock
+	uint32_t Time_ = micros();
+	Target->Set_Clock(Clock_);
+
+	// Record Clock
+	Record(ENV_TRACE_CLOCK, 0, Time_);
+	Put_Varint(Clock_);
+
+}
+void Environment_Recorder::Delay(const uint32_t Time_) {
+
+	// Record Delay
+	Record(ENV_TRACE_DELAY, 0, micros());
+	Put_Varint(Time_);
+
+	// Wait
+	Target->Delay(Time_);
+
+}
+bool Environment_Recorder::Set_Timeout(const uint32_t Timeout_) {
+
+	// Set Target Timeout
+	return(Target->Set_Timeout(Timeout_));
+
+}
+uint8_t Environment_Recorder::Recover(void) {
+
+	// Recover Target Bus
+	return(Target->Recover());
+
+}
+
+// Private Functions
+void Environment_Recorder::Record(const uint8_t Type_, const uint8_t Result_, const uint32_t Time_) {
+
+	// Control for Recording
+	if (!Recording) return;
+
+	// Record Type, Result and Time Delta
+	Put((uint8_t)((Type_ << 4) | (Result_ & 0x0F)));
+	Put_Varint(Time_ - Last_Time);
+
+	// Set Record Time
+	Last_Time = Time_;
+	Records++;
+
+}
+void Environment_Recorder::Put(const uint8_t Data_) {
+
+	// Control for Recording
+	if (!Recording) return;
+
+	// Control for Full Buffer
+	if (Position >= Buffer_Size) {
+
+		// Stop Without Output
+		if (Output == NULL) {
+
+			// Set Overflow
+			Overflowed = true;
+			Recording = false;
+
+			// End Function
+			return;
+
+		}
+
+		// Send Buffer
+		Output(Buffer, Position);
+		Position = 0;
+
+	}
+
+	// Store Byte
+	Buffer[Position++] = Data_;
+	Bytes++;
+
+}
+void Environment_Recorder::Put_Varint(uint32_t Value_) {
+
+	// Store 7 Bits per Byte
+	while (Value_ >= 0x80) {
+
+		// Store Byte With Continue Bit
+		Put((uint8_t)(Value_ | 0x80));
+		Value_ >>= 7;
+
+	}
+
+	// Store Last Byte
+	Put((uint8_t)Value_);
+
+}
+void Environment_Recorder::Put_Data(const uint8_t * Data_, const uint8_t Length_) {
+
+	// Store Length and Bytes
+	Put(Length_);
+	for (uint8_t i = 0; i < Length_; i++) Put(Data_[i]);
+
+}
+
+// ************************************************************
+// Replay
+// ************************************************************
+
+Environment_Replay::Environment_Replay(const uint8_t * Trace_, const uint32_t Length_) {
+
+	// Set Trace
+	Trace = Trace_;
+	Length = Length_;
+
+	// Start From First Record
+	Rewind();
+
+}
+
+// Replay Control Functions
+bool Environment_Replay::Valid(void) {
+
+	// Control for Header
+	if (Trace == NULL or Length < ENV_TRACE_HEADER_SIZE) return(false);
+
+	// Compare Header
+	for (uint8_t i = 0; i < ENV_TRACE_HEADER_SIZE; i++) if (Trace[i] != ENV_TRACE_MAGIC[i]) return(false);
+
+	// End Function
+	return(true);
+
+}
+void Environment_Replay::Rewind(void) {
+
+	// Set First Record
+	Position = Valid() ? ENV_TRACE_HEADER_SIZE : Length;
+
+	// Clear Statistics
+	Clock = 100000;
+	Transactions = 0;
+	Mismatches = 0;
+	Delays = 0;
+	Bus_Microseconds = 0;
+	Trace_Microseconds = 0;
+
+}
+bool Environment_Replay::Finished(void) {
+
+	// End Function
+	return(Position >= Length);
+
+}
+
+// Replay Statistic Functions
+uint32_t Environment_Replay::Transaction_Count(void) {
+
+	// End Function
+	return(Transactions);
+
+}
+uint32_t Environment_Replay::Mismatch_Count(void) {
+
+	// End Function
+	return(Mismatches);
+
+}
+uint32_t Environment_Replay::Delay_Total(void) {
+
+	// End Function (ms requested by replayed code)
+	return(Delays);
+
+}
+uint32_t Environment_Replay::Bus_Time(void) {
+
+	// End Function (us at replayed clock)
+	return(Bus_Microseconds);
+
+}
+uint32_t Environment_Replay::Modelled_Latency(void) {
+
+	// End Function (us, bus time and delays)
+	return(Bus_Microseconds + Delays * 1000);
+
+}
+uint32_t Environment_Replay::Recorded_Time(void) {
+
+	// End Function (us between consumed records on hardware)
+	return(Trace_Microseconds);
+
+}
+
+// Transaction Functions
+uint8_t Environment_Replay::Write(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_) {
+
+	// Count Transaction
+	Transactions++;
+	Model(Length_, 0);
+
+	// Get Record
+	uint8_t Result_;
+	if (!Next(ENV_TRACE_WRITE, Result_) or !Match(Address_, Data_, Length_)) {
+
+		// Count Mismatch
+		Mismatches++;
+
+		// End Function
+		return(ENV_TRANSPORT_ERROR);
+
+	}
+
+	// End Function
+	return(Result_);
+
+}
+uint8_t Environment_Replay::Read(const uint8_t Address_, uint8_t * Data_, const uint8_t Length_) {
+
+	// Count Transaction
+	Transactions++;
+	Model(0, Length_);
+
+	// Get Record
+	uint8_t Result_;
+	if (!Next(ENV_TRACE_READ, Result_) or Get() != Address_ or Copy(Data_, Length_) != Length_) {
+
+		// Count Mismatch
+		Mismatches++;
+
+		// End Function
+		return(ENV_TRANSPORT_ERROR);
+
+	}
+
+	// End Function
+	return(Result_);
+
+}
+uint8_t Environment_Replay::Write_Read(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_, uint8_t * Read_Data_, const uint8_t Read_Length_) {
+
+	// Count Transaction
+	Transactions++;
+	Model(Length_, Read_Length_);
+
+	// Get Record
+	uint8_t Result_;
+	if (!Next(ENV_TRACE_WRITE_READ, Result_) or !Match(Address_, Data_, Length_) or Copy(Read_Data_, Read_Length_) != Read_Length_) {
+
+		// Count Mismatch
+		Mismatches++;
+
+		// End Function
+		return(ENV_TRANSPORT_ERROR);
+
+	}
+
+	// End Function
+	return(Result_);
+
+}
+void Environment_Replay::Set_Clock(const uint32_t Clock_) {
+
+	// Set Modelled Clock
+	if (Clock_ > 0) Clock = Clock_;
+
+	// Consume Recorded Clock Change
+	if (Position < Length and (Trace[Position] >> 4) == ENV_TRACE_CLOCK) Skip_Record();
+
+}
+void Environment_Replay::Delay(const uint32_t Time_) {
+
+	// Model Delay (no wait)
+	Delays += Time_;
+
+	// Consume Recorded Delay
+	if (Position < Length and (Trace[Position] >> 4) == ENV_TRACE_DELAY) Skip_Record();
+
+}
+
+// Private Functions
+bool Environment_Replay::Next(const uint8_t Type_, uint8_t & Result_) {
+
+	// Find Next Transaction Record
+	while (Position < Length) {
+
+		// Get Record Type
+		uint8_t Type_Read_ = Trace[Position] >> 4;
+
+		// Skip Delays and Clock Changes Removed From Replayed Code
+		if (Type_Read_ == ENV_TRACE_DELAY or Type_Read_ == ENV_TRACE_CLOCK) {
+
+			// Skip Record
+			Skip_Record();
+			continue;
+
+		}
+
+		// Control for Type (a different transaction is skipped as mismatch)
+		if (Type_Read_ != Type_) {
+
+			// Skip Record
+			Skip_Record();
+
+			// End Function
+			return(false);
+
+		}
+
+		// Get Result and Time
+		Result_ = Get() & 0x0F;
+		Trace_Microseconds += Get_Varint();
+
+		// End Function
+		return(true);
+
+	}
+
+	// End of Trace
+	return(false);
+
+}
+bool Environment_Replay::Match(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_) {
+
+	// Get Address and Length
+	bool Match_ = (Get() == Address_);
+	uint8_t Length_Read_ = Get();
+
+	// Control for Length
+	if (Length_Read_ != Length_) Match_ = false;
+
+	// Compare Bytes
+	for (uint8_t i = 0; i < Length_Read_; i++) {
+
+		// Get Byte
+		uint8_t Data_Read_ = Get();
+
+		// Compare Byte
+		if (i < Length_ and Data_Read_ != Data_[i]) Match_ = false;
+
+	}
+
+	// End Function
+	return(Match_);
+
+}
+uint8_t Environment_Replay::Copy(uint8_t * Data_, const uint8_t Length_) {
+
+	// Get Length
+	uint8_t Length_Read_ = Get();
+
+	// Copy Bytes
+	for (uint8_t i = 0; i < Length_Read_; i++) {
+
+		// Get Byte
+		uint8_t Data_Read_ = Get();
+
+		// Set Byte
+		if (i < Length_) Data_[i] = Data_Read_;
+
+	}
+
+	// Clear Missing Bytes
+	for (uint8_t i = Length_Read_; i < Length_; i++) Data_[i] = 0x00;
+
+	// End Function
+	return(Length_Read_);
+
+}
+uint8_t Environment_Replay::Get(void) {
+
+	// Control for End of Trace
+	if (Position >= Length) return(0);
+
+	// End Function
+	return(Trace[Position++]);
+
+}
+uint32_t Environment_Replay::Get_Varint(void) {
+
+	// Declare Variables
+	uint32_t Value_ = 0;
+	uint8_t Shift_ = 0;
+
+	// Read 7 Bits per Byte
+	while (Position < Length and Shift_ < 32) {
+
+		// Get Byte
+		uint8_t Data_ = Get();
+
+		// Add Bits
+		Value_ |= (uint32_t)(Data_ & 0x7F) << Shift_;
+		Shift_ += 7;
+
+		// Control for Last Byte
+		if ((Data_ & 0x80) == 0) break;
+
+	}
+
+	// End Function
+	return(Value_);
+
+}
+void Environment_Replay::Skip_Record(void) {
+
+	// Get Record Type
+	uint8_t Type_ = Get() >> 4;
+
+	// Add Record Time
+	Trace_Microseconds += Get_Varint();
+
+	// Skip Body
+	switch (Type_) {
+
+		case ENV_TRACE_WRITE:
+		case ENV_TRACE_READ: {
+
+			// Skip Address and Bytes
+			Get();
+			uint8_t Length_ = Get();
+			for (uint8_t i = 0; i < Length_; i++) Get();
+			break;
+
+		}
+
+		case ENV_TRACE_WRITE_READ: {
+
+			// Skip Address, Written and Read Bytes
+			Get();
+			uint8_t Length_ = Get();
+			for (uint8_t i = 0; i < Length_; i++) Get();
+			Length_ = Get();
+			for (uint8_t i = 0; i < Length_; i++) Get();
+			break;
+
+		}
+
+		case ENV_TRACE_DELAY:
+		case ENV_TRACE_CLOCK:
+
+			// Skip Value
+			Get_Varint();
+			break;
+
+		default:
+
+			// Unknown Record, Stop Replay
+			Position = Length;
+
+	}
+
+}
+void Environment_Replay::Model(const uint8_t Write_Length_, const uint8_t Read_Length_) {
+
+	// Start and Stop Conditions
+	uint32_t Bits_ = 2;
+
+	// Write Message (address and data bytes, 9 clocks each)
+	if (Write_Length_ > 0 or Read_Length_ == 0) Bits_ += 9 * (1 + (uint32_t)Write_Length_);
+
+	// Read Message (repeated start after write)
+	if (Read_Length_ > 0) Bits_ += 9 * (1 + (uint32_t)Read_Length_) + ((Write_Length_ > 0) ? 1 : 0);
+
+	// Add Bus Time
+	Bus_Microseconds += (uint32_t)(((uint64_t)Bits_ * 1000000) / Clock);
+
+}
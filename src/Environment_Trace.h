@@ -0,0 +1,171 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Bus Trace Record and Replay.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Trace__
+#define __Environment_Trace__
+
+// Define Transport Interface
+#include "Environment_Transport.h"
+
+// ************************************************************
+// Trace Format
+// ************************************************************
+//
+//	Header	: 'E' 'N' 'V' 'T' Version
+//	Record	: Type (high nibble) | Result (low nibble), Time delta (varint us), Body
+//
+//	Write		: Address, Length, Bytes
+//	Read		: Address, Length, Bytes
+//	Write_Read	: Address, Write length, Write bytes, Read length, Read bytes
+//	Delay		: Time (varint ms)
+//	Clock		: Clock (varint Hz)
+//
+//	Varint is little endian base 128 (7 bits per byte, high bit set on all but last byte).
+
+// Trace Version
+#define ENV_TRACE_VERSION			1
+#define ENV_TRACE_HEADER_SIZE		5
+
+// Record Types
+#define ENV_TRACE_WRITE				1
+#define ENV_TRACE_READ				2
+#define ENV_TRACE_WRITE_READ		3
+#define ENV_TRACE_DELAY				4
+#define ENV_TRACE_CLOCK				5
+
+// Trace Output (called when the record buffer is full and on Flush)
+typedef void (*Environment_Trace_Output)(const uint8_t * Data_, const uint16_t Length_);
+
+// Recording Transport (forwards to target transport and records every call)
+class Environment_Recorder : public Environment_Transport
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Recorder(Environment_Transport & Target_, uint8_t * Buffer_, const uint16_t Size_, Environment_Trace_Output Output_ = NULL);
+
+	// Record Control
+	void Start(void);
+	void Stop(void);
+	void Flush(void);
+
+	// Record Status
+	uint32_t Record_Count(void);
+	uint32_t Trace_Size(void);
+	bool Overflow(void);
+
+	// Transactions
+	uint8_t Write(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_);
+	uint8_t Read(const uint8_t Address_, uint8_t * Data_, const uint8_t Length_);
+	uint8_t Write_Read(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_, uint8_t * Read_Data_, const uint8_t Read_Length_);
+	void Set_Clock(const uint32_t Clock_);
+	void Delay(const uint32_t Time_);
+
+	// Timeout and Recovery (forwarded, not recorded)
+	bool Set_Timeout(const uint32_t Timeout_);
+	uint8_t Recover(void);
+
+private:
+
+	// ************************************************************
+	// Record Variables
+	// ************************************************************
+
+	// Target Transport
+	Environment_Transport * Target;
+
+	// Record Buffer
+	uint8_t * Buffer;
+	uint16_t Buffer_Size;
+	uint16_t Position;
+	Environment_Trace_Output Output;
+
+	// Record State
+	bool Recording;
+	bool Overflowed;
+	uint32_t Last_Time;
+	uint32_t Records;
+	uint32_t Bytes;
+
+	// Record Functions
+	void Record(const uint8_t Type_, const uint8_t Result_, const uint32_t Time_);
+	void Put(const uint8_t Data_);
+	void Put_Varint(uint32_t Value_);
+	void Put_Data(const uint8_t * Data_, const uint8_t Length_);
+
+};
+
+// Replay Transport (feeds a recorded trace back to the drivers)
+class Environment_Replay : public Environment_Transport
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Replay(const uint8_t * Trace_, const uint32_t Length_);
+
+	// Replay Control
+	bool Valid(void);
+	void Rewind(void);
+	bool Finished(void);
+
+	// Replay Statistics
+	uint32_t Transaction_Count(void);
+	uint32_t Mismatch_Count(void);
+	uint32_t Delay_Total(void);
+	uint32_t Bus_Time(void);
+	uint32_t Modelled_Latency(void);
+	uint32_t Recorded_Time(void);
+
+	// Transactions
+	uint8_t Write(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_);
+	uint8_t Read(const uint8_t Address_, uint8_t * Data_, const uint8_t Length_);
+	uint8_t Write_Read(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_, uint8_t * Read_Data_, const uint8_t Read_Length_);
+	void Set_Clock(const uint32_t Clock_);
+	void Delay(const uint32_t Time_);
+
+private:
+
+	// ************************************************************
+	// Replay Variables
+	// ************************************************************
+
+	// Trace
+	const uint8_t * Trace;
+	uint32_t Length;
+	uint32_t Position;
+
+	// Replay State
+	uint32_t Clock;
+	uint32_t Transactions;
+	uint32_t Mismatches;
+	uint32_t Delays;
+	uint32_t Bus_Microseconds;
+	uint32_t Trace_Microseconds;
+
+	// Replay Functions
+	bool Next(const uint8_t Type_, uint8_t & Result_);
+	bool Match(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_);
+	uint8_t Copy(uint8_t * Data_, const uint8_t Length_);
+	uint8_t Get(void);
+	uint32_t Get_Varint(void);
+	void Skip_Record(void);
+	void Model(const uint8_t Write_Length_, const uint8_t Read_Length_);
+
+};
+
+#endif /* defined(__Environment_Trace__) */
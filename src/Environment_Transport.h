@@ -0,0 +1,55 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - I2C Transport Interface.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Transport__
+#define __Environment_Transport__
+
+// Define Platform Layer
+#include "Environment_Platform.h"
+
+// Transport Result Codes (Wire.endTransmission codes)
+#define ENV_TRANSPORT_OK			0		// Transaction done
+#define ENV_TRANSPORT_NACK_ADDRESS	2		// Address not acknowledged
+#define ENV_TRANSPORT_NACK_DATA		3		// Data not acknowledged
+#define ENV_TRANSPORT_ERROR			4		// Other bus error
+#define ENV_TRANSPORT_TIMEOUT		5		// Transaction timed out (SDA or SCL held low)
+#define ENV_TRANSPORT_SHORT_READ	7		// Device returned less bytes than requested
+
+// Raw I2C Transactions of a Platform
+class Environment_Transport
+{
+public:
+
+	// Write Bytes With Stop
+	virtual uint8_t Write(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_) = 0;
+
+	// Read Bytes With Stop
+	virtual uint8_t Read(const uint8_t Address_, uint8_t * Data_, const uint8_t Length_) = 0;
+
+	// Write Bytes, Repeated Start, Read Bytes With Stop
+	virtual uint8_t Write_Read(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_, uint8_t * Read_Data_, const uint8_t Read_Length_) = 0;
+
+	// Set SCL Clock (Hz)
+	virtual void Set_Clock(const uint32_t Clock_) = 0;
+
+	// Wait for Device (ms)
+	virtual void Delay(const uint32_t Time_) { delay(Time_); }
+
+	// Set Transaction Timeout (uS, 0 = wait forever, false when the platform can not bound transactions)
+	virtual bool Set_Timeout(const uint32_t Timeout_) { return(Timeout_ == 0); }
+
+	// Free a Hung Bus and Restart the Peripheral
+	virtual uint8_t Recover(void) { return(ENV_TRANSPORT_ERROR); }
+
+};
+
+#endif /* defined(__Environment_Transport__) */
@@ -0,0 +1,194 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Wire Transport.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#include "Environment_Wire.h"
+
+#if defined(ENV_PLATFORM_WIRE)
+
+Environment_Wire::Environment_Wire(TwoWire & Port_, const uint8_t SDA_Pin_, const uint8_t SCL_Pin_) {
+
+	// Set Wire Port
+	Port = &Port_;
+
+	// Set Recovery Pins
+	SDA_Pin = SDA_Pin_;
+	SCL_Pin = SCL_Pin_;
+
+	// Port Settings Untouched
+	Clock = 0;
+	Timeout = 0;
+
+}
+
+// Configuration Functions
+void Environment_Wire::Set_Pins(const uint8_t SDA_Pin_, const uint8_t SCL_Pin_) {
+
+	// Set Recovery Pins
+	SDA_Pin = SDA_Pin_;
+	SCL_Pin = SCL_Pin_;
+
+}
+
+// Transaction Functions
+uint8_t Environment_Wire::Write(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_) {
+
+	// Send Data
+	Port->beginTransmission(Address_);
+	for (uint8_t i = 0; i < Length_; i++) Port->write(Data_[i]);
+
+	// Close I2C Connection
+	return(Timed_Out(Port->endTransmission(true)));
+
+}
+uint8_t Environment_Wire::Read(const uint8_t Address_, uint8_t * Data_, const uint8_t Length_) {
+
+	// Request Data
+	uint8_t Count_ = Port->requestFrom(Address_, Length_);
+
+	// Read I2C Bytes
+	for (uint8_t i = 0; i < Length_; i++) Data_[i] = (i < Count_) ? (uint8_t)Port->read() : 0x00;
+
+	// Control for Timeout (held clock or data line)
+	if (Timed_Out(ENV_TRANSPORT_OK) != ENV_TRANSPORT_OK) return(ENV_TRANSPORT_TIMEOUT);
+
+	// Control for Address (no byte read, device busy or not present)
+	if (Count_ == 0) return(ENV_TRANSPORT_NACK_ADDRESS);
+
+	// Control for Data Length
+	if (Count_ != Length_) return(ENV_TRANSPORT_SHORT_READ);
+
+	// End Function
+	return(ENV_TRANSPORT_OK);
+
+}
+uint8_t Environment_Wire::Write_Read(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_, uint8_t * Read_Data_, const uint8_t Read_Length_) {
+
+	// Send Data
+	Port->beginTransmission(Address_);
+	for (uint8_t i = 0; i < Length_; i++) Port->write(Data_[i]);
+
+	// Close I2C Connection With Repeated Start
+	uint8_t Result_ = Timed_Out(Port->endTransmission(false));
+
+	// Control For Command Success
+	if (Result_ != ENV_TRANSPORT_OK) return(Result_);
+
+	// Read Data
+	return(Read(Address_, Read_Data_, Read_Length_));
+
+}
+void Environment_Wire::Set_Clock(const uint32_t Clock_) {
+
+	// Set Clock
+	Port->setClock(Clock_);
+	Clock = Clock_;
+
+}
+
+// Timeout and Recovery Functions
+bool Environment_Wire::Set_Timeout(const uint32_t Timeout_) {
+
+	// Set Timeout
+	Timeout = Timeout_;
+
+#if defined(WIRE_HAS_TIMEOUT)
+
+	// Set Wire Timeout (no reset by Wire, bus layer recovers)
+	Port->setWireTimeout(Timeout_, false);
+	Port->clearWireTimeoutFlag();
+
+	// End Function
+	return(true);
+
+#else
+
+	// End Function (core without timeout waits forever)
+	return(Timeout_ == 0);
+
+#endif
+
+}
+uint8_t Environment_Wire::Recover(void) {
+
+	// Control for Pins
+	if (SDA_Pin == ENV_WIRE_NO_PIN or SCL_Pin == ENV_WIRE_NO_PIN) return(ENV_TRANSPORT_ERROR);
+
+	// Release Pins From Peripheral
+	Port->end();
+
+	// Release Lines (open drain, pull ups hold them high)
+	pinMode(SDA_Pin, INPUT_PULLUP);
+	pinMode(SCL_Pin, INPUT_PULLUP);
+	delayMicroseconds(ENV_WIRE_RECOVERY_HALF);
+
+	// Clock Pulses (device holding SDA shifts out the rest of its byte)
+	for (uint8_t i = 0; i < ENV_WIRE_RECOVERY_PULSES; i++) {
+
+		// Pull Clock Low
+		digitalWrite(SCL_Pin, LOW);
+		pinMode(SCL_Pin, OUTPUT);
+		delayMicroseconds(ENV_WIRE_RECOVERY_HALF);
+
+		// Release Clock
+		pinMode(SCL_Pin, INPUT_PULLUP);
+		delayMicroseconds(ENV_WIRE_RECOVERY_HALF);
+
+	}
+
+	// STOP Condition (SDA rises while SCL is high)
+	digitalWrite(SCL_Pin, LOW);
+	pinMode(SCL_Pin, OUTPUT);
+	digitalWrite(SDA_Pin, LOW);
+	pinMode(SDA_Pin, OUTPUT);
+	delayMicroseconds(ENV_WIRE_RECOVERY_HALF);
+	pinMode(SCL_Pin, INPUT_PULLUP);
+	delayMicroseconds(ENV_WIRE_RECOVERY_HALF);
+	pinMode(SDA_Pin, INPUT_PULLUP);
+	delayMicroseconds(ENV_WIRE_RECOVERY_HALF);
+
+	// Control for Free Bus
+	bool Free_ = (digitalRead(SDA_Pin) == HIGH and digitalRead(SCL_Pin) == HIGH);
+
+	// Restart Peripheral With Port Settings
+	Port->begin();
+	if (Clock != 0) Port->setClock(Clock);
+	if (Timeout != 0) Set_Timeout(Timeout);
+
+	// End Function
+	return(Free_ ? ENV_TRANSPORT_OK : ENV_TRANSPORT_ERROR);
+
+}
+
+// Private Functions
+uint8_t Environment_Wire::Timed_Out(const uint8_t Result_) {
+
+#if defined(WIRE_HAS_TIMEOUT)
+
+	// Control for Timeout Flag
+	if (Port->getWireTimeoutFlag()) {
+
+		// Clear Flag
+		Port->clearWireTimeoutFlag();
+
+		// End Function
+		return(ENV_TRANSPORT_TIMEOUT);
+
+	}
+
+#endif
+
+	// End Function
+	return(Result_);
+
+}
+
+#endif /* defined(ENV_PLATFORM_WIRE) */
@@ -0,0 +1,80 @@
+/* *******************************************************************************
+ *  Copyright (C) 2014-2019 Mehmet Gunce Akkoyun Can not be copied and/or
+ *	distributed without the express permission of Mehmet Gunce Akkoyun
+ *	This library is a combined book of enviroment sensor library.
+ *
+ *	Library				: Environment Library - Wire Transport.
+ *	Code Developer		: Mehmet Gunce Akkoyun (akkoyun@me.com)
+ *	Revision			: 3.1.0
+ *	Relase				: 12.10.2020
+ *
+ *********************************************************************************/
+
+#ifndef __Environment_Wire__
+#define __Environment_Wire__
+
+// Define Transport Interface
+#include "Environment_Transport.h"
+
+#if defined(ENV_PLATFORM_WIRE)
+
+// Bus Recovery Pins (variant Wire pins when known)
+#define ENV_WIRE_NO_PIN				0xFF
+#if defined(PIN_WIRE_SDA) and defined(PIN_WIRE_SCL)
+#define ENV_WIRE_SDA				PIN_WIRE_SDA
+#define ENV_WIRE_SCL				PIN_WIRE_SCL
+#else
+#define ENV_WIRE_SDA				ENV_WIRE_NO_PIN
+#define ENV_WIRE_SCL				ENV_WIRE_NO_PIN
+#endif
+
+// Bus Recovery Clock (half period, uS)
+#define ENV_WIRE_RECOVERY_HALF		5
+#define ENV_WIRE_RECOVERY_PULSES	9
+
+class Environment_Wire : public Environment_Transport
+{
+public:
+
+	// ************************************************************
+	// Public Functions
+	// ************************************************************
+
+	Environment_Wire(TwoWire & Port_, const uint8_t SDA_Pin_ = ENV_WIRE_SDA, const uint8_t SCL_Pin_ = ENV_WIRE_SCL);
+
+	// Bus Recovery Pins
+	void Set_Pins(const uint8_t SDA_Pin_, const uint8_t SCL_Pin_);
+
+	// Transactions
+	uint8_t Write(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_);
+	uint8_t Read(const uint8_t Address_, uint8_t * Data_, const uint8_t Length_);
+	uint8_t Write_Read(const uint8_t Address_, const uint8_t * Data_, const uint8_t Length_, uint8_t * Read_Data_, const uint8_t Read_Length_);
+	void Set_Clock(const uint32_t Clock_);
+
+	// Timeout and Recovery (timeout needs a core with setWireTimeout, false without)
+	bool Set_Timeout(const uint32_t Timeout_);
+	uint8_t Recover(void);
+
+private:
+
+	// Wire Port
+	TwoWire * Port;
+
+	// Recovery Pins
+	uint8_t SDA_Pin;
+	uint8_t SCL_Pin;
+
+	// Port Settings (restored after recovery, 0 = not set)
+	uint32_t Clock;
+	uint32_t Timeout;
+
+	// Timeout Functions
+	uint8_t Timed_Out(const uint8_t Result_);
+
+};
+
+extern Environment_Wire Environment_Wire_Port;
+
+#endif /* defined(ENV_PLATFORM_WIRE) */
+
+#endif /* defined(__Environment_Wire__) */